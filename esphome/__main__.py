@@ -360,10 +360,16 @@ def upload_program(config, args, host):
             config, args.username, args.password, args.client_id
         )
 
+    firmware = CORE.firmware_bin
     if getattr(args, "file", None) is not None:
-        return espota2.run_ota(host, remote_port, password, args.file)
+        firmware = args.file
 
-    return espota2.run_ota(host, remote_port, password, CORE.firmware_bin)
+    if getattr(args, "delta_from", None) is not None:
+        from esphome import ota_delta
+
+        firmware = ota_delta.write_patch_file(args.delta_from, firmware)
+
+    return espota2.run_ota(host, remote_port, password, firmware)
 
 
 def show_logs(config, args, port):
@@ -812,6 +818,10 @@ def parse_args(argv):
         "--file",
         help="Manually specify the binary file to upload.",
     )
+    parser_upload.add_argument(
+        "--delta-from",
+        help="Upload only the differences to this binary, which must be the firmware running on the device.",
+    )
 
     parser_logs = subparsers.add_parser(
         "logs",
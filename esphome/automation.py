@@ -6,6 +6,7 @@ from esphome.const import (
     CONF_COUNT,
     CONF_ELSE,
     CONF_ID,
+    CONF_POLL_INTERVAL,
     CONF_THEN,
     CONF_TIME,
     CONF_TIMEOUT,
@@ -287,6 +288,7 @@ _validate_wait_until = cv.maybe_simple_value(
     {
         cv.Required(CONF_CONDITION): validate_potentially_and_condition,
         cv.Optional(CONF_TIMEOUT): cv.templatable(cv.positive_time_period_milliseconds),
+        cv.Optional(CONF_POLL_INTERVAL): cv.positive_time_period_milliseconds,
     },
     key=CONF_CONDITION,
 )
@@ -299,6 +301,8 @@ async def wait_until_action_to_code(config, action_id, template_arg, args):
     if CONF_TIMEOUT in config:
         template_ = await cg.templatable(config[CONF_TIMEOUT], args, cg.uint32)
         cg.add(var.set_timeout_value(template_))
+    if CONF_POLL_INTERVAL in config:
+        cg.add(var.set_poll_interval(config[CONF_POLL_INTERVAL]))
     await cg.register_component(var, {})
     return var
 
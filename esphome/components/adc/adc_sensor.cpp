@@ -37,6 +37,9 @@ static const int32_t SOC_ADC_RTC_MAX_BITWIDTH = 12;
 
 static const int ADC_MAX = (1 << SOC_ADC_RTC_MAX_BITWIDTH) - 1;    // 4095 (12 bit) or 8191 (13 bit)
 static const int ADC_HALF = (1 << SOC_ADC_RTC_MAX_BITWIDTH) >> 1;  // 2048 (12 bit) or 4096 (13 bit)
+
+/// Raw samples buffered between reads in continuous mode.
+static const size_t CONTINUOUS_BUFFER_SAMPLES = 1024;
 #endif
 
 #ifdef USE_RP2040
@@ -144,6 +147,11 @@ void ADCSensor::dump_config() {
 
 float ADCSensor::get_setup_priority() const { return setup_priority::DATA; }
 void ADCSensor::update() {
+#ifdef USE_ESP32
+  // the timer owns the channel while sampling continuously, and the samples are for whoever started it
+  if (this->continuous_)
+    return;
+#endif
   float value_v = this->sample();
   ESP_LOGV(TAG, "'%s': Got voltage=%.4fV", this->get_name().c_str(), value_v);
   this->publish_state(value_v);
@@ -175,6 +183,8 @@ float ADCSensor::sample() {
 
 #ifdef USE_ESP32
 float ADCSensor::sample() {
+  if (this->continuous_)
+    return NAN;
   if (!this->autorange_) {
     uint32_t sum = 0;
     for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
@@ -252,6 +262,81 @@ float ADCSensor::sample() {
   uint32_t mv_scaled = (mv12 * c12) + (mv6 * c6) + (mv2 * c2) + (mv0 * c0);
   return mv_scaled / (float) (csum * 1000U);
 }
+
+bool ADCSensor::start_continuous(uint32_t sample_rate) {
+  // automatic attenuation needs several conversions per sample, and ADC2 is shared with Wi-Fi
+  if (this->autorange_ || this->channel1_ == ADC1_CHANNEL_MAX || sample_rate == 0)
+    return false;
+
+  if (this->continuous_buffer_ == nullptr) {
+    this->continuous_buffer_ = RingBuffer::create(CONTINUOUS_BUFFER_SAMPLES * sizeof(uint16_t));
+    if (this->continuous_buffer_ == nullptr) {
+      ESP_LOGW(TAG, "'%s': Could not allocate the sample buffer", this->get_name().c_str());
+      return false;
+    }
+  }
+  if (this->continuous_timer_ == nullptr) {
+    esp_timer_create_args_t timer_args{};
+    timer_args.callback = &ADCSensor::continuous_sample_;
+    timer_args.arg = this;
+    timer_args.name = "adc_sample";
+    if (esp_timer_create(&timer_args, &this->continuous_timer_) != ESP_OK) {
+      ESP_LOGW(TAG, "'%s': Could not create the sample timer", this->get_name().c_str());
+      return false;
+    }
+  }
+
+  this->stop_continuous();
+  this->continuous_batch_size_ = 0;
+  // a conversion takes a few tens of microseconds, don't go faster than that
+  const uint64_t period_us = std::max<uint32_t>(1000000 / sample_rate, 50);
+  this->continuous_ = esp_timer_start_periodic(this->continuous_timer_, period_us) == ESP_OK;
+  return this->continuous_;
+}
+
+void ADCSensor::stop_continuous() {
+  if (this->continuous_timer_ != nullptr)
+    esp_timer_stop(this->continuous_timer_);
+  this->continuous_ = false;
+  if (this->continuous_buffer_ != nullptr)
+    this->continuous_buffer_->reset();
+}
+
+size_t ADCSensor::read_samples(float *samples, size_t count) {
+  if (this->continuous_buffer_ == nullptr)
+    return 0;
+
+  const esp_adc_cal_characteristics_t *characteristics = &this->cal_characteristics_[(int32_t) this->attenuation_];
+  uint16_t raw[32];
+  size_t total = 0;
+  while (total < count) {
+    const size_t wanted = std::min(count - total, sizeof(raw) / sizeof(raw[0]));
+    const size_t read = this->continuous_buffer_->read(raw, wanted * sizeof(uint16_t)) / sizeof(uint16_t);
+    if (read == 0)
+      break;
+    for (size_t i = 0; i < read; i++) {
+      samples[total + i] =
+          this->output_raw_ ? raw[i] : esp_adc_cal_raw_to_voltage(raw[i], characteristics) / 1000.0f;
+    }
+    total += read;
+  }
+  return total;
+}
+
+void ADCSensor::continuous_sample_(void *arg) {
+  auto *sensor = static_cast<ADCSensor *>(arg);
+  const int raw = adc1_get_raw(sensor->channel1_);
+  if (raw < 0)
+    return;
+  sensor->continuous_batch_[sensor->continuous_batch_size_++] = raw;
+  if (sensor->continuous_batch_size_ == sizeof(sensor->continuous_batch_) / sizeof(sensor->continuous_batch_[0])) {
+    // if the reader has fallen behind, drop the batch instead of holding up the timer task
+    if (sensor->continuous_buffer_->free() >= sizeof(sensor->continuous_batch_))
+      sensor->continuous_buffer_->write_without_replacement(sensor->continuous_batch_,
+                                                            sizeof(sensor->continuous_batch_));
+    sensor->continuous_batch_size_ = 0;
+  }
+}
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
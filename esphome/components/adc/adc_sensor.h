@@ -8,7 +8,9 @@
 
 #ifdef USE_ESP32
 #include <esp_adc_cal.h>
+#include <esp_timer.h>
 #include "driver/adc.h"
+#include "esphome/core/ring_buffer.h"
 #endif
 
 namespace esphome {
@@ -57,6 +59,14 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   void set_sample_count(uint8_t sample_count);
   float sample() override;
 
+#ifdef USE_ESP32
+  /// Sample at a fixed rate from a timer; only available for ADC1 channels without automatic attenuation.
+  /// While it runs, sample() returns NAN and update() doesn't publish.
+  bool start_continuous(uint32_t sample_rate) override;
+  void stop_continuous() override;
+  size_t read_samples(float *samples, size_t count) override;
+#endif
+
 #ifdef USE_ESP8266
   std::string unique_id() override;
 #endif
@@ -79,6 +89,16 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   adc1_channel_t channel1_{ADC1_CHANNEL_MAX};
   adc2_channel_t channel2_{ADC2_CHANNEL_MAX};
   bool autorange_{false};
+
+  static void continuous_sample_(void *arg);
+  esp_timer_handle_t continuous_timer_{nullptr};
+  /// Sampling from the timer; the polled update() and sample() are suspended meanwhile.
+  bool continuous_{false};
+  /// Raw samples taken by the timer, waiting to be read.
+  std::unique_ptr<RingBuffer> continuous_buffer_;
+  /// Samples taken by the timer, moved to continuous_buffer_ a batch at a time.
+  uint16_t continuous_batch_[16];
+  uint8_t continuous_batch_size_{0};
 #if ESP_IDF_VERSION_MAJOR >= 5
   esp_adc_cal_characteristics_t cal_characteristics_[SOC_ADC_ATTEN_NUM] = {};
 #else
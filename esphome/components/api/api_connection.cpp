@@ -26,6 +26,10 @@ namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+#ifdef USE_ESP32_CAMERA
+static const size_t ESP32_CAMERA_MIN_CHUNK_SIZE = 1024;
+static const size_t ESP32_CAMERA_MAX_CHUNK_SIZE = 8192;
+#endif
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
@@ -149,23 +153,12 @@ void APIConnection::loop() {
   }
 
 #ifdef USE_ESP32_CAMERA
-  if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
-    uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
-    // fixed32 key = 1;
-    buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
-    // bytes data = 2;
-    buffer.encode_bytes(2, this->image_reader_.peek_data_buffer(), to_send);
-    // bool done = 3;
-    bool done = this->image_reader_.available() == to_send;
-    buffer.encode_bool(3, done);
-    bool success = this->send_buffer(buffer, 44);
-
-    if (success) {
-      this->image_reader_.consume_data(to_send);
-    }
-    if (success && done) {
-      this->image_reader_.return_image();
+  if (this->image_reader_.available()) {
+    // grow the chunks while the connection keeps up, shrink them when it doesn't
+    if (!this->helper_->can_write_without_blocking()) {
+      this->image_chunk_size_ = std::max(this->image_chunk_size_ / 2, ESP32_CAMERA_MIN_CHUNK_SIZE);
+    } else {
+      this->send_image_chunk_();
     }
   }
 #endif
@@ -523,15 +516,19 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 #endif
 
 #ifdef USE_TEXT_SENSOR
-bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
+bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, const std::string &state) {
   if (!this->state_subscription_)
     return false;
 
-  TextSensorStateResponse resp{};
-  resp.key = text_sensor->get_object_id_hash();
-  resp.state = std::move(state);
-  resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  // encoded in place, so the state isn't copied into a TextSensorStateResponse for every client
+  auto buffer = this->create_buffer();
+  // fixed32 key = 1;
+  buffer.encode_fixed32(1, text_sensor->get_object_id_hash());
+  // string state = 2;
+  buffer.encode_string(2, state);
+  // bool missing_state = 3;
+  buffer.encode_bool(3, !text_sensor->has_state());
+  return this->send_buffer(buffer, 27);
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -1064,11 +1061,30 @@ void APIConnection::media_player_command(const MediaPlayerCommandRequest &msg) {
 void APIConnection::send_camera_state(std::shared_ptr<esp32_camera::CameraImage> image) {
   if (!this->state_subscription_)
     return;
-  if (this->image_reader_.available())
-    return;
   if (image->was_requested_by(esphome::esp32_camera::API_REQUESTER) ||
       image->was_requested_by(esphome::esp32_camera::IDLE))
-    this->image_reader_.set_image(std::move(image));
+    this->image_reader_.offer_image(std::move(image));
+}
+void APIConnection::send_image_chunk_() {
+  uint32_t to_send = std::min(this->image_chunk_size_, this->image_reader_.available());
+  auto buffer = this->create_buffer();
+  buffer.get_buffer()->reserve(to_send + 16);
+  // fixed32 key = 1;
+  buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
+  // bytes data = 2;
+  buffer.encode_bytes(2, this->image_reader_.peek_data_buffer(), to_send);
+  // bool done = 3;
+  bool done = this->image_reader_.available() == to_send;
+  buffer.encode_bool(3, done);
+  bool success = this->send_buffer(buffer, 44);
+
+  if (success) {
+    this->image_reader_.consume_data(to_send);
+    this->image_chunk_size_ = std::min(this->image_chunk_size_ * 2, ESP32_CAMERA_MAX_CHUNK_SIZE);
+  }
+  if (success && done) {
+    this->image_reader_.return_image();
+  }
 }
 bool APIConnection::send_camera_info(esp32_camera::ESP32Camera *camera) {
   ListEntitiesCameraResponse msg;
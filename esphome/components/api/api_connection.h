@@ -54,7 +54,7 @@ class APIConnection : public APIServerConnection {
   void switch_command(const SwitchCommandRequest &msg) override;
 #endif
 #ifdef USE_TEXT_SENSOR
-  bool send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state);
+  bool send_text_sensor_state(text_sensor::TextSensor *text_sensor, const std::string &state);
   bool send_text_sensor_info(text_sensor::TextSensor *text_sensor);
 #endif
 #ifdef USE_ESP32_CAMERA
@@ -229,6 +229,10 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+#ifdef USE_ESP32_CAMERA
+  /// Send the next chunk of the camera image being read.
+  void send_image_chunk_();
+#endif
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -250,6 +254,7 @@ class APIConnection : public APIServerConnection {
   uint32_t client_api_version_minor_{0};
 #ifdef USE_ESP32_CAMERA
   esp32_camera::CameraImageReader image_reader_;
+  size_t image_chunk_size_{1024};
 #endif
 
   bool state_subscription_{false};
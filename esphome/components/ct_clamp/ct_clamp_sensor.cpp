@@ -12,42 +12,43 @@ static const char *const TAG = "ct_clamp";
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
+  ESP_LOGCONFIG(TAG, "  Sample Rate: %" PRIu32 " Hz", this->sample_rate_);
   LOG_UPDATE_INTERVAL(this);
 }
 
 void CTClampSensor::update() {
-  // Update only starts the sampling phase, in loop() the actual sampling is happening.
+  // Update only starts the sampling phase, the samples are collected in loop().
+  this->last_value_ = 0.0;
+  this->stats_.reset();
+  this->is_continuous_ = this->sample_rate_ != 0 && this->source_->start_continuous(this->sample_rate_);
 
-  // Request a high loop() execution interval during sampling phase.
-  this->high_freq_.start();
+  // Without a source that samples by itself, request a high loop() execution interval during sampling phase.
+  if (!this->is_continuous_)
+    this->high_freq_.start();
 
   // Set timeout for ending sampling phase
   this->set_timeout("read", this->sample_duration_, [this]() {
+    if (this->is_continuous_) {
+      this->read_continuous_();
+      this->source_->stop_continuous();
+    } else {
+      this->high_freq_.stop();
+    }
     this->is_sampling_ = false;
-    this->high_freq_.stop();
 
-    if (this->num_samples_ == 0) {
+    const uint32_t num_samples = this->stats_.get_count();
+    if (num_samples == 0) {
       // Shouldn't happen, but let's not crash if it does.
       this->publish_state(NAN);
       return;
     }
 
-    const float rms_ac_dc_squared = this->sample_squared_sum_ / this->num_samples_;
-    const float rms_dc = this->sample_sum_ / this->num_samples_;
-    const float rms_ac_squared = rms_ac_dc_squared - rms_dc * rms_dc;
-    float rms_ac = 0;
-    if (rms_ac_squared > 0)
-      rms_ac = std::sqrt(rms_ac_squared);
+    const float rms_ac = this->stats_.get_ac_rms();
     ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %" PRIu32 " different samples (%" PRIu32 " SPS)",
-             this->name_.c_str(), rms_ac, this->num_samples_, 1000 * this->num_samples_ / this->sample_duration_);
+             this->name_.c_str(), rms_ac, num_samples, 1000 * num_samples / this->sample_duration_);
     this->publish_state(rms_ac);
   });
 
-  // Set sampling values
-  this->last_value_ = 0.0;
-  this->num_samples_ = 0;
-  this->sample_sum_ = 0.0f;
-  this->sample_squared_sum_ = 0.0f;
   this->is_sampling_ = true;
 }
 
@@ -55,6 +56,11 @@ void CTClampSensor::loop() {
   if (!this->is_sampling_)
     return;
 
+  if (this->is_continuous_) {
+    this->read_continuous_();
+    return;
+  }
+
   // Perform a single sample
   float value = this->source_->sample();
   if (std::isnan(value))
@@ -65,9 +71,14 @@ void CTClampSensor::loop() {
     return;
   this->last_value_ = value;
 
-  this->num_samples_++;
-  this->sample_sum_ += value;
-  this->sample_squared_sum_ += value * value;
+  this->stats_.add(value);
+}
+
+void CTClampSensor::read_continuous_() {
+  float samples[64];
+  size_t count;
+  while ((count = this->source_->read_samples(samples, sizeof(samples) / sizeof(samples[0]))) != 0)
+    this->stats_.add(samples, count);
 }
 
 }  // namespace ct_clamp
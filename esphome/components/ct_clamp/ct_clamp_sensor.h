@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
 #include "esphome/components/sensor/sensor.h"
+#include "esphome/components/voltage_sampler/sample_stats.h"
 #include "esphome/components/voltage_sampler/voltage_sampler.h"
 
 namespace esphome {
@@ -19,14 +20,20 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   }
 
   void set_sample_duration(uint32_t sample_duration) { sample_duration_ = sample_duration; }
+  void set_sample_rate(uint32_t sample_rate) { sample_rate_ = sample_rate; }
   void set_source(voltage_sampler::VoltageSampler *source) { source_ = source; }
 
  protected:
   /// High Frequency loop() requester used during sampling phase.
   HighFrequencyLoopRequester high_freq_;
 
+  /// Read the samples the source has taken in the background.
+  void read_continuous_();
+
   /// Duration in ms of the sampling phase.
   uint32_t sample_duration_;
+  /// Samples per second to request from sources that can sample continuously.
+  uint32_t sample_rate_{0};
   /// The sampling source to read values from.
   voltage_sampler::VoltageSampler *source_;
 
@@ -42,12 +49,12 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
    *   3) Sum of sample squared
    * https://en.wikipedia.org/wiki/Root_mean_square
    */
+  voltage_sampler::SampleStats stats_;
 
   float last_value_ = 0.0f;
-  float sample_sum_ = 0.0f;
-  float sample_squared_sum_ = 0.0f;
-  uint32_t num_samples_ = 0;
   bool is_sampling_ = false;
+  /// Whether the source is sampling at a fixed rate by itself, instead of being polled from loop().
+  bool is_continuous_ = false;
 };
 
 }  // namespace ct_clamp
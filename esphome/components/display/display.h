@@ -256,6 +256,32 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Start drawing a block of packed pixels like draw_pixels_at(), but return before all of them have been sent where
+   * the display supports it. In that case the result is true, and until wait_draw_complete() has been called the data
+   * at ptr must stay unchanged and nothing else may be drawn on the display. A false result means the pixels have
+   * already been drawn. The default implementation always draws synchronously.
+   */
+  virtual bool draw_pixels_at_async(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
+                                    ColorBitness bitness, bool big_endian) {
+    this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian);
+    return false;
+  }
+
+  /// Block until a draw started with draw_pixels_at_async() has finished.
+  virtual void wait_draw_complete() {}
+
+  /** Draw a single row of pixels encoded in the nominated format, e.g. one row of an image.
+   * Unlike draw_pixels_at(), the row ends up wherever draw_pixel_at() would put it, i.e. rotated and in the
+   * display's buffer if it has one. The naive implementation here draws pixel by pixel; sub-classes can
+   * override it to copy the whole row at once.
+   *
+   * The caller must have clipped the row to the display and its clipping region, and ptr must point to RAM.
+   */
+  virtual void draw_pixel_row_at(int x_start, int y, int w, const uint8_t *ptr, ColorOrder order,
+                                 ColorBitness bitness, bool big_endian) {
+    Display::draw_pixels_at(x_start, y, w, 1, ptr, order, bitness, big_endian, 0, 0, 0);
+  }
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
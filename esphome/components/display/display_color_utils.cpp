@@ -0,0 +1,83 @@
+#include "display_color_utils.h"
+#include <cstring>
+
+namespace esphome {
+namespace display {
+
+const uint16_t *get_rgb332_to_565_lut() {
+  static uint16_t lut[256];
+  static bool initialized = false;
+  if (!initialized) {
+    for (size_t i = 0; i != 256; i++)
+      lut[i] = ColorUtil::color_to_565(ColorUtil::rgb332_to_color(i));
+    initialized = true;
+  }
+  return lut;
+}
+
+void fill_palette888_to_565_lut(const uint8_t *palette, uint16_t *lut) {
+  for (size_t i = 0; i != 256; i++)
+    lut[i] = ColorUtil::color_to_565(ColorUtil::index8_to_color_palette888(i, palette));
+}
+
+static inline void put_666(uint8_t *dst, uint16_t color) {
+  dst[0] = (uint8_t) ((color & 0xF800) >> 8);
+  dst[1] = (uint8_t) ((color & 0x7E0) >> 3);
+  dst[2] = (uint8_t) (color << 3);
+}
+
+void convert_row_565be_to_565be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+  memcpy(dst, src, count * 2);
+}
+
+void convert_row_565le_to_565be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+  // swap the bytes of two pixels at a time, memcpy keeps the word accesses alignment safe
+  for (; count >= 2; count -= 2, src += 4, dst += 4) {
+    uint32_t word;
+    memcpy(&word, src, 4);
+    word = ((word & 0x00FF00FF) << 8) | ((word >> 8) & 0x00FF00FF);
+    memcpy(dst, &word, 4);
+  }
+  if (count != 0) {
+    dst[0] = src[1];
+    dst[1] = src[0];
+  }
+}
+
+void convert_row_565be_to_666(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+  for (; count != 0; count--, src += 2, dst += 3)
+    put_666(dst, (src[0] << 8) | src[1]);
+}
+
+void convert_row_565le_to_666(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+  for (; count != 0; count--, src += 2, dst += 3)
+    put_666(dst, (src[1] << 8) | src[0]);
+}
+
+void convert_row_lut8_to_565be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+  // unrolled by four, the lookups are independent
+  for (; count >= 4; count -= 4, src += 4, dst += 8) {
+    uint16_t c0 = lut[src[0]], c1 = lut[src[1]], c2 = lut[src[2]], c3 = lut[src[3]];
+    dst[0] = c0 >> 8;
+    dst[1] = c0;
+    dst[2] = c1 >> 8;
+    dst[3] = c1;
+    dst[4] = c2 >> 8;
+    dst[5] = c2;
+    dst[6] = c3 >> 8;
+    dst[7] = c3;
+  }
+  for (; count != 0; count--, src++, dst += 2) {
+    uint16_t color = lut[*src];
+    dst[0] = color >> 8;
+    dst[1] = color;
+  }
+}
+
+void convert_row_lut8_to_666(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+  for (; count != 0; count--, src++, dst += 3)
+    put_666(dst, lut[*src]);
+}
+
+}  // namespace display
+}  // namespace esphome
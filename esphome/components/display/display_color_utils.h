@@ -155,5 +155,35 @@ class ColorUtil {
     return color;
   }
 };
+
+/***
+ * Row conversion kernels.
+ *
+ * These convert a run of pixels from a frame buffer format into the byte stream a panel expects, without a
+ * per-pixel format switch or Color round trip. Drivers pick the kernel once per flush and then hand it whole rows.
+ * 8 bit formats (RGB332, palette indexes) are converted through a 256 entry RGB565 lookup table. Big endian RGB565
+ * is the order sent over the wire, 18 bit panels take 3 bytes per pixel with the 565 components left aligned.
+ */
+
+/// Kernel signature: convert `count` pixels from `src` into `dst`. `lut` is only used by the 8 bit sources.
+using PixelRowConverter = void (*)(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
+
+/// Returns the shared RGB332 to RGB565 lookup table, built on first use.
+const uint16_t *get_rgb332_to_565_lut();
+/// Fill `lut` (256 entries) with the RGB565 values of a 256*3 byte RGB palette.
+void fill_palette888_to_565_lut(const uint8_t *palette, uint16_t *lut);
+
+/// Big endian RGB565 to big endian RGB565 (plain copy).
+void convert_row_565be_to_565be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
+/// Little endian RGB565 to big endian RGB565 (byte swap, two pixels per word).
+void convert_row_565le_to_565be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
+/// Big endian RGB565 to 18 bit (3 bytes per pixel).
+void convert_row_565be_to_666(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
+/// Little endian RGB565 to 18 bit (3 bytes per pixel).
+void convert_row_565le_to_666(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
+/// 8 bit lookup (RGB332 or palette index) to big endian RGB565.
+void convert_row_lut8_to_565be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
+/// 8 bit lookup (RGB332 or palette index) to 18 bit (3 bytes per pixel).
+void convert_row_lut8_to_666(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut);
 }  // namespace display
 }  // namespace esphome
@@ -1,16 +1,19 @@
 #ifdef USE_ARDUINO
 
 #include "dsmr.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-#include <AES.h>
 #include <Crypto.h>
-#include <GCM.h>
+
+#include <algorithm>
 
 namespace esphome {
 namespace dsmr {
 
 static const char *const TAG = "dsmr";
+/// Size of the GCM authentication tag at the end of an encrypted telegram.
+static const size_t CRYPT_TAG_SIZE = 12;
 
 void Dsmr::setup() {
   this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
@@ -130,6 +133,7 @@ void Dsmr::reset_telegram_() {
   this->bytes_read_ = 0;
   this->crypt_bytes_read_ = 0;
   this->crypt_telegram_len_ = 0;
+  this->crypt_telegram_done_ = false;
   this->last_read_time_ = 0;
 }
 
@@ -146,41 +150,7 @@ void Dsmr::receive_telegram_() {
     if (!this->header_found_)
       continue;
 
-    // Check for buffer overflow.
-    if (this->bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
-      return;
-    }
-
-    // Some v2.2 or v3 meters will send a new value which starts with '('
-    // in a new line, while the value belongs to the previous ObisId. For
-    // proper parsing, remove these new line characters.
-    if (c == '(') {
-      while (true) {
-        auto previous_char = this->telegram_[this->bytes_read_ - 1];
-        if (previous_char == '\n' || previous_char == '\r') {
-          this->bytes_read_--;
-        } else {
-          break;
-        }
-      }
-    }
-
-    // Store the byte in the buffer.
-    this->telegram_[this->bytes_read_] = c;
-    this->bytes_read_++;
-
-    // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
-    if (c == '!') {
-      ESP_LOGV(TAG, "Footer of telegram found");
-      this->footer_found_ = true;
-      continue;
-    }
-    // Check for the end of the hex checksum, i.e. a newline.
-    if (this->footer_found_ && c == '\n') {
-      // Parse the telegram and publish sensor values.
-      this->parse_telegram();
+    if (this->receive_byte_(c)) {
       this->reset_telegram_();
       return;
     }
@@ -189,77 +159,195 @@ void Dsmr::receive_telegram_() {
 
 void Dsmr::receive_encrypted_telegram_() {
   while (this->available_within_timeout_()) {
-    const char c = this->read();
-
     // Find a new telegram start byte.
     if (!this->header_found_) {
-      if ((uint8_t) c != 0xDB) {
+      if (this->read() != 0xDB) {
         continue;
       }
       ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
       this->reset_telegram_();
       this->header_found_ = true;
+      this->crypt_header_[0] = 0xDB;
+      this->crypt_bytes_read_ = 1;
+      continue;
     }
 
-    // Check for buffer overflow.
-    if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
+    // Read the header, which holds the length of the encrypted telegram and the IV.
+    if (this->crypt_bytes_read_ < sizeof(this->crypt_header_)) {
+      this->crypt_header_[this->crypt_bytes_read_++] = this->read();
+      if (this->crypt_bytes_read_ < sizeof(this->crypt_header_)) {
+        continue;
+      }
+
+      // Complete header + data bytes
+      this->crypt_telegram_len_ = 13 + (this->crypt_header_[11] << 8 | this->crypt_header_[12]);
+      ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+      if (this->crypt_telegram_len_ > this->max_telegram_len_) {
+        this->reset_telegram_();
+        ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+        return;
+      }
+      if (this->crypt_telegram_len_ < sizeof(this->crypt_header_) + CRYPT_TAG_SIZE) {
+        this->reset_telegram_();
+        ESP_LOGE(TAG, "Error: encrypted telegram too short (%d bytes)", this->crypt_telegram_len_);
+        return;
+      }
+
+      // the iv is 8 bytes of the system title + 4 bytes frame counter
+      // system title is at byte 2 and frame counter at byte 14
+      uint8_t iv[12];
+      memcpy(iv, &this->crypt_header_[2], 8);
+      memcpy(iv + 8, &this->crypt_header_[14], 4);
+      this->gcm_->setIV(iv, sizeof(iv));
+      continue;
+    }
+
+    // Decrypt the ciphertext as it comes in, and feed it to the telegram parser. The rest of the frame,
+    // i.e. the GCM tag and anything after the end of the telegram, is read and dropped, so none of it
+    // can be taken for the start of the next frame.
+    const size_t ciphertext_end = this->crypt_telegram_len_ - CRYPT_TAG_SIZE;
+    const bool in_ciphertext = this->crypt_bytes_read_ < ciphertext_end;
+    uint8_t chunk[64];
+    size_t len = std::min({sizeof(chunk), static_cast<size_t>(this->available()),
+                           (in_ciphertext ? ciphertext_end : this->crypt_telegram_len_) - this->crypt_bytes_read_});
+    if (!this->read_array(chunk, len)) {
       this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
       return;
     }
+    this->crypt_bytes_read_ += len;
+    if (in_ciphertext && !this->crypt_telegram_done_) {
+      this->gcm_->decrypt(chunk, chunk, len);
+      for (size_t i = 0; i < len; i++) {
+        if (this->receive_byte_(chunk[i])) {
+          this->crypt_telegram_done_ = true;
+          break;
+        }
+      }
+    }
 
-    // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
-    this->crypt_bytes_read_++;
+    if (this->crypt_bytes_read_ >= this->crypt_telegram_len_) {
+      if (!this->crypt_telegram_done_)
+        ESP_LOGW(TAG, "End of encrypted telegram reached without a complete telegram");
+      this->reset_telegram_();
+      return;
+    }
+  }
+}
 
-    // Read the length of the incoming encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
-      // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
-      ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+bool Dsmr::receive_byte_(char c) {
+  // A forward slash starts the telegram; anything before it is ignored.
+  if (c == '/') {
+    this->bytes_read_ = 0;
+    this->footer_found_ = false;
+    this->line_start_ = 1;
+    this->crc_bytes_ = 0;
+    this->crc_ = 0;
+    this->data_ = MyData();
+    this->parse_result_ = ::dsmr::ParseResult<void>();
+  } else if (this->bytes_read_ == 0) {
+    return false;
+  }
+
+  // Check for buffer overflow.
+  if (this->bytes_read_ >= this->max_telegram_len_) {
+    ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+    return true;
+  }
+
+  // Some v2.2 or v3 meters will send a new value which starts with '('
+  // in a new line, while the value belongs to the previous ObisId. For
+  // proper parsing, remove these new line characters.
+  if (c == '(') {
+    while (true) {
+      auto previous_char = this->telegram_[this->bytes_read_ - 1];
+      if (previous_char == '\n' || previous_char == '\r') {
+        this->bytes_read_--;
+      } else {
+        break;
+      }
     }
+  }
 
-    // Check for the end of the encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
-      continue;
+  // Everything before a character other than a line break is final now: add it to the
+  // checksum, and parse the line it ends, so only the checksum is left after the footer.
+  if (!this->footer_found_ && c != '\r' && c != '\n' && this->bytes_read_ > 0) {
+    this->crc_ = crc16(reinterpret_cast<const uint8_t *>(this->telegram_ + this->crc_bytes_),
+                       this->bytes_read_ - this->crc_bytes_, this->crc_);
+    this->crc_bytes_ = this->bytes_read_;
+
+    auto previous_char = this->telegram_[this->bytes_read_ - 1];
+    if (previous_char == '\n' || previous_char == '\r') {
+      this->parse_line_(this->line_start_, this->bytes_read_);
+      this->line_start_ = this->bytes_read_;
+    } else if (c == '!' && this->parse_result_.err == nullptr) {
+      ::dsmr::ParseResult<void> res;
+      this->parse_result_ = res.fail(F("Last dataline not CRLF terminated"), this->telegram_ + this->bytes_read_);
     }
-    ESP_LOGV(TAG, "End of encrypted telegram found");
-
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
-    // the iv is 8 bytes of the system title + 4 bytes frame counter
-    // system title is at byte 2 and frame counter at byte 15
-    for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
-    constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
-
-    // Parse the decrypted telegram and publish sensor values.
+  }
+
+  // Store the byte in the buffer.
+  this->telegram_[this->bytes_read_] = c;
+  this->bytes_read_++;
+
+  // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
+  if (c == '!' && !this->footer_found_) {
+    ESP_LOGV(TAG, "Footer of telegram found");
+    this->footer_found_ = true;
+    this->crc_ = crc16(reinterpret_cast<const uint8_t *>(&c), 1, this->crc_);
+    this->crc_bytes_ = this->bytes_read_;
+    return false;
+  }
+  // Check for the end of the hex checksum, i.e. a newline.
+  if (this->footer_found_ && c == '\n') {
+    // Check the telegram and publish sensor values.
     this->parse_telegram();
-    this->reset_telegram_();
+    return true;
+  }
+  return false;
+}
+
+void Dsmr::parse_line_(size_t start, size_t end) {
+  // Like the full telegram parser, stop at the first error
+  if (this->parse_result_.err != nullptr)
+    return;
+
+  // Only the part up to the first line break holds data
+  const char *line = this->telegram_ + start;
+  const char *line_end = line;
+  while (line_end < this->telegram_ + end && *line_end != '\r' && *line_end != '\n')
+    line_end++;
+
+  if (start == 1) {
+    // The identification line right after the header, handled like P1Parser::parse_data() does
+    if (line + 3 >= line_end || (line[3] != '5' && line[3] != '3')) {
+      ::dsmr::ParseResult<void> res;
+      this->parse_result_ = res.fail(F("Invalid identification string"), line);
+      return;
+    }
+    this->parse_result_ = this->data_.parse_line(::dsmr::ObisId(255, 255, 255, 255, 255, 255), line, line_end);
     return;
   }
+  this->parse_result_ = ::dsmr::P1Parser::parse_line(&this->data_, line, line_end, false);
 }
 
 bool Dsmr::parse_telegram() {
-  MyData data;
   ESP_LOGV(TAG, "Trying to parse telegram");
   this->stop_requesting_data_();
 
-  ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
-                              this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
+  // The lines have been parsed while receiving, only the checksum is left. Like the full
+  // telegram parser, report a checksum error before any error in the lines.
+  ::dsmr::ParseResult<void> res;
+  if (this->crc_check_) {
+    ::dsmr::ParseResult<uint16_t> crc_res =
+        ::dsmr::CrcParser::parse(this->telegram_ + this->crc_bytes_, this->telegram_ + this->bytes_read_);
+    if (crc_res.err != nullptr) {
+      res = crc_res;
+    } else if (crc_res.result != this->crc_) {
+      res.fail(F("Checksum mismatch"), this->telegram_ + this->crc_bytes_);
+    }
+  }
+  if (res.err == nullptr)
+    res = this->parse_result_;
   if (res.err) {
     // Parsing error, show it
     auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
@@ -267,7 +355,7 @@ bool Dsmr::parse_telegram() {
     return false;
   } else {
     this->status_clear_warning();
-    this->publish_sensors(data);
+    this->publish_sensors(this->data_);
 
     // publish the telegram, after publishing the sensors so it can also trigger action based on latest values
     if (this->s_telegram_ != nullptr) {
@@ -299,10 +387,8 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
   if (decryption_key.length() == 0) {
     ESP_LOGI(TAG, "Disabling decryption");
     this->decryption_key_.clear();
-    if (this->crypt_telegram_ != nullptr) {
-      delete[] this->crypt_telegram_;
-      this->crypt_telegram_ = nullptr;
-    }
+    delete this->gcm_;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->gcm_ = nullptr;
     return;
   }
 
@@ -322,9 +408,11 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
     this->decryption_key_.push_back(std::strtoul(temp, nullptr, 16));
   }
 
-  if (this->crypt_telegram_ == nullptr) {
-    this->crypt_telegram_ = new uint8_t[this->max_telegram_len_];  // NOLINT
+  // The cipher is kept for all telegrams, only the IV changes
+  if (this->gcm_ == nullptr) {
+    this->gcm_ = new GCM<AES128>();  // NOLINT
   }
+  this->gcm_->setKey(this->decryption_key_.data(), this->gcm_->keySize());
 }
 
 }  // namespace dsmr
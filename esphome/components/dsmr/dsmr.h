@@ -13,6 +13,9 @@
 #include <dsmr/parser.h>
 #include <dsmr/fields.h>
 
+#include <AES.h>
+#include <GCM.h>
+
 #include <vector>
 
 namespace esphome {
@@ -92,6 +95,10 @@ class Dsmr : public Component, public uart::UARTDevice {
   void receive_telegram_();
   void receive_encrypted_telegram_();
   void reset_telegram_();
+  /// Add a byte of the (decrypted) telegram, true once the telegram has been handled or dropped.
+  bool receive_byte_(char c);
+  /// Parse a completed line of the telegram into data_.
+  void parse_line_(size_t start, size_t end);
 
   /// Wait for UART data to become available within the read timeout.
   ///
@@ -120,9 +127,21 @@ class Dsmr : public Component, public uart::UARTDevice {
   size_t max_telegram_len_;
   char *telegram_{nullptr};
   size_t bytes_read_{0};
-  uint8_t *crypt_telegram_{nullptr};
+  /// Start of the last line, which is parsed once the next line starts.
+  size_t line_start_{0};
+  /// Bytes of the telegram included in crc_; the line breaks after them may still be dropped.
+  size_t crc_bytes_{0};
+  uint16_t crc_{0};
+  /// Values of the lines parsed so far, and the first parse error.
+  MyData data_;
+  ::dsmr::ParseResult<void> parse_result_;
+  /// Start byte, system title, length, security byte and frame counter of an encrypted telegram.
+  uint8_t crypt_header_[18];
   size_t crypt_telegram_len_{0};
   size_t crypt_bytes_read_{0};
+  /// The telegram has been handled, the rest of the encrypted frame is dropped.
+  bool crypt_telegram_done_{false};
+  GCM<AES128> *gcm_{nullptr};
   uint32_t last_read_time_{0};
   bool header_found_{false};
   bool footer_found_{false};
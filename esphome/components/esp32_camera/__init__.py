@@ -39,6 +39,7 @@ ESP32CameraStreamStopTrigger = esp32_camera_ns.class_(
     "ESP32CameraStreamStopTrigger",
     automation.Trigger.template(),
 )
+CameraRequester = esp32_camera_ns.enum("CameraRequester")
 ESP32CameraFrameSize = esp32_camera_ns.enum("ESP32CameraFrameSize")
 FRAME_SIZES = {
     "160X120": ESP32CameraFrameSize.ESP32_CAMERA_SIZE_160X120,
@@ -140,6 +141,7 @@ CONF_TEST_PATTERN = "test_pattern"
 # framerates
 CONF_MAX_FRAMERATE = "max_framerate"
 CONF_IDLE_FRAMERATE = "idle_framerate"
+CONF_API_MAX_FRAMERATE = "api_max_framerate"
 # frame buffer
 CONF_FRAME_BUFFER_COUNT = "frame_buffer_count"
 
@@ -215,6 +217,9 @@ CONFIG_SCHEMA = cv.ENTITY_BASE_SCHEMA.extend(
         cv.Optional(CONF_IDLE_FRAMERATE, default="0.1 fps"): cv.All(
             cv.framerate, cv.Range(min=0, max=1)
         ),
+        cv.Optional(CONF_API_MAX_FRAMERATE): cv.All(
+            cv.framerate, cv.Range(min=0, min_included=False, max=60)
+        ),
         cv.Optional(CONF_FRAME_BUFFER_COUNT, default=1): cv.int_range(min=1, max=2),
         cv.Optional(CONF_ON_STREAM_START): automation.validate_automation(
             {
@@ -288,6 +293,12 @@ async def to_code(config):
         cg.add(var.set_idle_update_interval(0))
     else:
         cg.add(var.set_idle_update_interval(1000 / config[CONF_IDLE_FRAMERATE]))
+    if CONF_API_MAX_FRAMERATE in config:
+        cg.add(
+            var.set_requester_max_update_interval(
+                CameraRequester.API_REQUESTER, 1000 / config[CONF_API_MAX_FRAMERATE]
+            )
+        )
     cg.add(var.set_frame_buffer_count(config[CONF_FRAME_BUFFER_COUNT]))
     cg.add(var.set_frame_size(config[CONF_RESOLUTION]))
 
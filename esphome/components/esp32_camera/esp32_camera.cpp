@@ -31,8 +31,9 @@ void ESP32Camera::setup() {
   this->update_camera_parameters();
 
   /* initialize RTOS */
-  this->framebuffer_get_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
-  this->framebuffer_return_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
+  this->framebuffer_get_queue_ = xQueueCreate(this->config_.fb_count, sizeof(camera_fb_t *));
+  this->framebuffer_slots_ = xSemaphoreCreateCounting(this->config_.fb_count, this->config_.fb_count);
+  this->images_.reserve(this->config_.fb_count);
   xTaskCreatePinnedToCore(&ESP32Camera::framebuffer_task,
                           "framebuffer_task",  // name
                           1024,                // stack size
@@ -153,13 +154,7 @@ void ESP32Camera::dump_config() {
 }
 
 void ESP32Camera::loop() {
-  // check if we can return the image
-  if (this->can_return_image_()) {
-    // return image
-    auto *fb = this->current_image_->get_raw_buffer();
-    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
-    this->current_image_.reset();
-  }
+  this->return_images_();
 
   // request idle image every idle_update_interval
   const uint32_t now = millis();
@@ -171,12 +166,15 @@ void ESP32Camera::loop() {
   // Check if we should fetch a new image
   if (!this->has_requested_image_())
     return;
-  if (this->current_image_.use_count() > 1) {
-    // image is still in use
+  if (this->images_.size() == this->config_.fb_count) {
+    // all frame buffers are still in use
     return;
   }
   if (now - this->last_update_ <= this->max_update_interval_)
     return;
+  const uint8_t requesters = this->get_frame_requesters_(now);
+  if (requesters == 0)
+    return;
 
   // request new image
   camera_fb_t *fb;
@@ -188,13 +186,18 @@ void ESP32Camera::loop() {
 
   if (fb == nullptr) {
     ESP_LOGW(TAG, "Got invalid frame from camera!");
-    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+    xSemaphoreGive(this->framebuffer_slots_);
     return;
   }
-  this->current_image_ = std::make_shared<CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
+  auto image = std::make_shared<CameraImage>(fb, requesters);
+  for (uint8_t requester = 0; requester != CAMERA_REQUESTER_COUNT; requester++) {
+    if (requesters & (1U << requester))
+      this->requester_last_update_[requester] = now;
+  }
+  this->images_.push_back(image);
 
   ESP_LOGD(TAG, "Got Image: len=%u", fb->len);
-  this->new_image_callback_.call(this->current_image_);
+  this->new_image_callback_.call(std::move(image));
   this->last_update_ = now;
   this->single_requesters_ = 0;
 }
@@ -387,14 +390,33 @@ void ESP32Camera::update_camera_parameters() {
 
 /* ---------------- Internal methods ---------------- */
 bool ESP32Camera::has_requested_image_() const { return this->single_requesters_ || this->stream_requesters_; }
-bool ESP32Camera::can_return_image_() const { return this->current_image_.use_count() == 1; }
+uint8_t ESP32Camera::get_frame_requesters_(uint32_t now) {
+  uint8_t requesters = this->single_requesters_;
+  for (uint8_t requester = 0; requester != CAMERA_REQUESTER_COUNT; requester++) {
+    if ((this->stream_requesters_ & (1U << requester)) &&
+        now - this->requester_last_update_[requester] >= this->requester_max_update_interval_[requester])
+      requesters |= 1U << requester;
+  }
+  return requesters;
+}
+void ESP32Camera::return_images_() {
+  for (auto it = this->images_.begin(); it != this->images_.end();) {
+    if (it->use_count() != 1) {
+      it++;
+      continue;
+    }
+    // the driver queues returned buffers, so this is safe while the framebuffer task waits for the next frame
+    esp_camera_fb_return((*it)->get_raw_buffer());
+    xSemaphoreGive(this->framebuffer_slots_);
+    it = this->images_.erase(it);
+  }
+}
 void ESP32Camera::framebuffer_task(void *pv) {
   while (true) {
+    // only take a frame from the driver while a frame buffer is free to be handed out
+    xSemaphoreTake(global_esp32_camera->framebuffer_slots_, portMAX_DELAY);
     camera_fb_t *framebuffer = esp_camera_fb_get();
     xQueueSend(global_esp32_camera->framebuffer_get_queue_, &framebuffer, portMAX_DELAY);
-    // return is no-op for config with 1 fb
-    xQueueReceive(global_esp32_camera->framebuffer_return_queue_, &framebuffer, portMAX_DELAY);
-    esp_camera_fb_return(framebuffer);
   }
 }
 
@@ -411,7 +433,20 @@ size_t CameraImageReader::available() const {
 
   return this->image_->get_data_length() - this->offset_;
 }
-void CameraImageReader::return_image() { this->image_.reset(); }
+void CameraImageReader::offer_image(std::shared_ptr<CameraImage> image) {
+  if (this->image_) {
+    // drop the oldest waiting frame, if any
+    this->next_image_ = std::move(image);
+  } else {
+    this->set_image(std::move(image));
+  }
+}
+void CameraImageReader::return_image() {
+  this->image_.reset();
+  this->offset_ = 0;
+  if (this->next_image_)
+    this->set_image(std::move(this->next_image_));
+}
 void CameraImageReader::consume_data(size_t consumed) { this->offset_ += consumed; }
 uint8_t *CameraImageReader::peek_data_buffer() { return this->image_->get_data_buffer() + this->offset_; }
 
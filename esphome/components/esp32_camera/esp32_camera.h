@@ -9,6 +9,8 @@
 #include <esp_camera.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <vector>
 
 namespace esphome {
 namespace esp32_camera {
@@ -17,6 +19,7 @@ class ESP32Camera;
 
 /* ---------------- enum classes ---------------- */
 enum CameraRequester { IDLE, API_REQUESTER, WEB_REQUESTER };
+static const uint8_t CAMERA_REQUESTER_COUNT = 3;
 
 enum ESP32CameraFrameSize {
   ESP32_CAMERA_SIZE_160X120,    // QQVGA
@@ -95,6 +98,12 @@ struct CameraImageData {
 class CameraImageReader {
  public:
   void set_image(std::shared_ptr<CameraImage> image);
+  /** Offer a new frame to a reader that may still be busy with the previous one.
+   *
+   * If the reader is busy, the frame waits until return_image(), replacing any frame already waiting. A slow reader
+   * so only holds on to the frame it is reading and the newest one.
+   */
+  void offer_image(std::shared_ptr<CameraImage> image);
   size_t available() const;
   uint8_t *peek_data_buffer();
   void consume_data(size_t consumed);
@@ -102,6 +111,7 @@ class CameraImageReader {
 
  protected:
   std::shared_ptr<CameraImage> image_;
+  std::shared_ptr<CameraImage> next_image_;
   size_t offset_{0};
 };
 
@@ -145,6 +155,10 @@ class ESP32Camera : public Component, public EntityBase {
   /* -- framerates */
   void set_max_update_interval(uint32_t max_update_interval);
   void set_idle_update_interval(uint32_t idle_update_interval);
+  /// Limit the rate of stream frames for one requester, on top of the overall max_update_interval.
+  void set_requester_max_update_interval(CameraRequester requester, uint32_t max_update_interval) {
+    this->requester_max_update_interval_[requester] = max_update_interval;
+  }
   /* -- frame buffer */
   void set_frame_buffer_mode(camera_grab_mode_t mode);
   void set_frame_buffer_count(uint8_t fb_count);
@@ -167,7 +181,10 @@ class ESP32Camera : public Component, public EntityBase {
  protected:
   /* internal methods */
   bool has_requested_image_() const;
-  bool can_return_image_() const;
+  /// The requesters the next frame is for, leaving out streams that are rate limited.
+  uint8_t get_frame_requesters_(uint32_t now);
+  /// Return the frames no consumer holds any more to the camera driver.
+  void return_images_();
 
   static void framebuffer_task(void *pv);
 
@@ -197,13 +214,17 @@ class ESP32Camera : public Component, public EntityBase {
   /* -- framerates */
   uint32_t max_update_interval_{1000};
   uint32_t idle_update_interval_{15000};
+  uint32_t requester_max_update_interval_[CAMERA_REQUESTER_COUNT]{};
+  uint32_t requester_last_update_[CAMERA_REQUESTER_COUNT]{};
 
   esp_err_t init_error_{ESP_OK};
-  std::shared_ptr<CameraImage> current_image_;
+  /// Frames handed out to consumers, shared without copying until the last one lets go.
+  std::vector<std::shared_ptr<CameraImage>> images_;
   uint8_t single_requesters_{0};
   uint8_t stream_requesters_{0};
   QueueHandle_t framebuffer_get_queue_;
-  QueueHandle_t framebuffer_return_queue_;
+  /// Counts the frame buffers the framebuffer task may still take from the driver.
+  SemaphoreHandle_t framebuffer_slots_;
   CallbackManager<void(std::shared_ptr<CameraImage>)> new_image_callback_{};
   CallbackManager<void()> stream_start_callback_{};
   CallbackManager<void()> stream_stop_callback_{};
@@ -1,5 +1,6 @@
 import esphome.config_validation as cv
 import esphome.codegen as cg
+from esphome.components.esp32_camera import CONF_MAX_FRAMERATE
 from esphome.const import CONF_ID, CONF_PORT, CONF_MODE
 
 CODEOWNERS = ["@ayufan"]
@@ -17,6 +18,9 @@ CONFIG_SCHEMA = cv.Schema(
         cv.GenerateID(): cv.declare_id(CameraWebServer),
         cv.Required(CONF_PORT): cv.port,
         cv.Required(CONF_MODE): cv.enum(MODES, upper=True),
+        cv.Optional(CONF_MAX_FRAMERATE): cv.All(
+            cv.framerate, cv.Range(min=0, min_included=False, max=60)
+        ),
     },
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -25,4 +29,6 @@ async def to_code(config):
     server = cg.new_Pvariable(config[CONF_ID])
     cg.add(server.set_port(config[CONF_PORT]))
     cg.add(server.set_mode(config[CONF_MODE]))
+    if CONF_MAX_FRAMERATE in config:
+        cg.add(server.set_max_update_interval(1000 / config[CONF_MAX_FRAMERATE]))
     await cg.register_component(server, config)
@@ -67,6 +67,11 @@ void CameraWebServer::setup() {
 
   httpd_register_uri_handler(this->httpd_, &uri);
 
+  if (this->max_update_interval_ != 0) {
+    esp32_camera::global_esp32_camera->set_requester_max_update_interval(esp32_camera::WEB_REQUESTER,
+                                                                          this->max_update_interval_);
+  }
+
   esp32_camera::global_esp32_camera->add_image_callback([this](std::shared_ptr<esp32_camera::CameraImage> image) {
     if (this->running_ && image->was_requested_by(esp32_camera::WEB_REQUESTER)) {
       this->image_ = std::move(image);
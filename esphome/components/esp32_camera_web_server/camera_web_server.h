@@ -29,6 +29,7 @@ class CameraWebServer : public Component {
   float get_setup_priority() const override;
   void set_port(uint16_t port) { this->port_ = port; }
   void set_mode(Mode mode) { this->mode_ = mode; }
+  void set_max_update_interval(uint32_t max_update_interval) { this->max_update_interval_ = max_update_interval; }
   void loop() override;
 
  protected:
@@ -43,6 +44,7 @@ class CameraWebServer : public Component {
   std::shared_ptr<esphome::esp32_camera::CameraImage> image_;
   bool running_{false};
   Mode mode_{STREAM};
+  uint32_t max_update_interval_{0};
 };
 
 }  // namespace esp32_camera_web_server
@@ -6,6 +6,7 @@ import esphome.final_validate as fv
 from esphome.components.ota import BASE_OTA_SCHEMA, ota_to_code, OTAComponent
 from esphome.config_helpers import merge_config
 from esphome.const import (
+    CONF_BUFFER_SIZE,
     CONF_ESPHOME,
     CONF_ID,
     CONF_NUM_ATTEMPTS,
@@ -103,6 +104,14 @@ CONFIG_SCHEMA = (
                 rtl87xx=8892,
             ): cv.port,
             cv.Optional(CONF_PASSWORD): cv.string,
+            cv.SplitDefault(
+                CONF_BUFFER_SIZE,
+                esp8266=1024,
+                esp32=4096,
+                rp2040=1024,
+                bk72xx=1024,
+                rtl87xx=1024,
+            ): cv.All(cv.validate_bytes, cv.int_range(min=512, max=16384)),
             cv.Optional(CONF_NUM_ATTEMPTS): cv.invalid(
                 f"'{CONF_SAFE_MODE}' (and its related configuration variables) has moved from 'ota' to its own component. See https://esphome.io/components/safe_mode"
             ),
@@ -126,6 +135,7 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await ota_to_code(var, config)
     cg.add(var.set_port(config[CONF_PORT]))
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
     if CONF_PASSWORD in config:
         cg.add(var.set_auth_password(config[CONF_PASSWORD]))
         cg.add_define("USE_OTA_PASSWORD")
@@ -8,6 +8,7 @@
 #include "esphome/components/ota/ota_backend_arduino_libretiny.h"
 #include "esphome/components/ota/ota_backend_arduino_rp2040.h"
 #include "esphome/components/ota/ota_backend_esp_idf.h"
+#include "esphome/components/ota/ota_pipeline.h"
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -73,6 +74,7 @@ void ESPHomeOTAComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Over-The-Air updates:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
   ESP_LOGCONFIG(TAG, "  Version: %d", USE_OTA_VERSION);
+  ESP_LOGCONFIG(TAG, "  Buffer Size: %u", this->buffer_size_);
 #ifdef USE_OTA_PASSWORD
   if (!this->password_.empty()) {
     ESP_LOGCONFIG(TAG, "  Password configured");
@@ -88,12 +90,15 @@ void ESPHomeOTAComponent::handle_() {
   ota::OTAResponseTypes error_code = ota::OTA_RESPONSE_ERROR_UNKNOWN;
   bool update_started = false;
   size_t total = 0;
+  size_t buffered = 0;
   uint32_t last_progress = 0;
+  uint32_t transfer_start = 0;
   uint8_t buf[1024];
   char *sbuf = reinterpret_cast<char *>(buf);
   size_t ota_size;
   uint8_t ota_features;
   std::unique_ptr<ota::OTABackend> backend;
+  std::unique_ptr<ota::OTAPipeline> pipeline;
   (void) ota_features;
 #if USE_OTA_VERSION == 2
   size_t size_acknowledged = 0;
@@ -248,14 +253,22 @@ void ESPHomeOTAComponent::handle_() {
   ESP_LOGV(TAG, "Update: Binary MD5 is %s", sbuf);
   backend->set_update_md5(sbuf);
 
+  pipeline = make_unique<ota::OTAPipeline>(backend.get(), this->buffer_size_);
+  if (!pipeline->init()) {
+    error_code = ota::OTA_RESPONSE_ERROR_UPDATE_PREPARE;
+    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+  }
+
   // Acknowledge MD5 OK - 1 byte
   buf[0] = ota::OTA_RESPONSE_BIN_MD5_OK;
   this->writeall_(buf, 1);
 
+  transfer_start = millis();
   while (total < ota_size) {
     // TODO: timeout check
-    size_t requested = std::min(sizeof(buf), ota_size - total);
-    ssize_t read = this->client_->read(buf, requested);
+    // Fill the pipeline buffer completely so flash is written in large chunks, while the previous one is written
+    size_t requested = std::min(pipeline->get_buffer_size() - buffered, ota_size - total);
+    ssize_t read = this->client_->read(pipeline->get_buffer() + buffered, requested);
     if (read == -1) {
       if (errno == EAGAIN || errno == EWOULDBLOCK) {
         App.feed_wdt();
@@ -272,12 +285,16 @@ void ESPHomeOTAComponent::handle_() {
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
     }
 
-    error_code = backend->write(buf, read);
-    if (error_code != ota::OTA_RESPONSE_OK) {
-      ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
-    }
+    buffered += read;
     total += read;
+    if (buffered == pipeline->get_buffer_size() || total == ota_size) {
+      error_code = pipeline->submit(buffered);
+      if (error_code != ota::OTA_RESPONSE_OK) {
+        ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
+        goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      }
+      buffered = 0;
+    }
 #if USE_OTA_VERSION == 2
     while (size_acknowledged + OTA_BLOCK_SIZE <= total || (total == ota_size && size_acknowledged < ota_size)) {
       buf[0] = ota::OTA_RESPONSE_CHUNK_OK;
@@ -300,6 +317,18 @@ void ESPHomeOTAComponent::handle_() {
     }
   }
 
+  error_code = pipeline->flush();
+  if (error_code != ota::OTA_RESPONSE_OK) {
+    ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
+    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+  }
+  {
+    uint32_t duration = std::max<uint32_t>(millis() - transfer_start, 1);
+    ESP_LOGI(TAG, "Received %u bytes in %.1fs (%.1f KB/s), %.1fs spent waiting for flash writes", ota_size,
+             duration / 1000.0f, ota_size / 1.024f / duration, pipeline->get_wait_time_ms() / 1000.0f);
+  }
+  pipeline = nullptr;
+
   // Acknowledge receive OK - 1 byte
   buf[0] = ota::OTA_RESPONSE_RECEIVE_OK;
   this->writeall_(buf, 1);
@@ -337,6 +366,8 @@ error:
   this->client_->close();
   this->client_ = nullptr;
 
+  // Let a write in progress finish before aborting
+  pipeline = nullptr;
   if (backend != nullptr && update_started) {
     backend->abort();
   }
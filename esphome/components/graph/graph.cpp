@@ -17,6 +17,7 @@ static const char *const TAGL = "graphlegend";
 
 void HistoryData::init(int length) {
   this->length_ = length;
+  // Buffers for wide graphs can get large, prefer PSRAM when available
   this->samples_.resize(length, NAN);
   this->last_sample_ = millis();
 }
@@ -26,29 +27,82 @@ void HistoryData::take_sample(float data) {
   uint32_t dt = tm - last_sample_;
   last_sample_ = tm;
 
-  // Step data based on time
+  // Step data based on time, columns without samples of their own repeat the new value
   this->period_ += dt;
+  if (this->period_ < this->update_time_) {
+    this->accumulate_(data);
+    return;
+  }
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
     this->period_ -= this->update_time_;
-    this->count_ = (this->count_ + 1) % this->length_;
+    this->advance_(data);
     ESP_LOGV(TAG, "Updating trace with value: %f", data);
   }
-  if (!std::isnan(data)) {
-    // Recalc recent max/min
-    this->recent_min_ = data;
-    this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
-    }
+}
+
+void HistoryData::advance_(float data) {
+  // the current column is complete now
+  float done = this->samples_[this->count_];
+  if (!std::isnan(done)) {
+    if (std::isnan(this->recent_min_) || done < this->recent_min_)
+      this->recent_min_ = done;
+    if (std::isnan(this->recent_max_) || done > this->recent_max_)
+      this->recent_max_ = done;
+  }
+  this->count_ = (this->count_ + 1) % this->length_;
+  float evicted = this->samples_[this->count_];
+  this->samples_[this->count_] = NAN;
+  this->bucket_samples_ = 0;
+  if (evicted <= this->recent_min_ || evicted >= this->recent_max_)
+    this->recalc_recent_();
+  this->accumulate_(data);
+}
+
+void HistoryData::accumulate_(float data) {
+  if (std::isnan(data))
+    return;
+  float &avg = this->samples_[this->count_];
+  if (this->bucket_samples_ == 0) {
+    avg = data;
+  } else {
+    avg += (data - avg) / (this->bucket_samples_ + 1);
+  }
+  if (this->bucket_samples_ < UINT16_MAX)
+    this->bucket_samples_++;
+}
+
+void HistoryData::recalc_recent_() {
+  this->recent_min_ = NAN;
+  this->recent_max_ = NAN;
+  for (int i = 0; i < this->length_; i++) {
+    float v = this->samples_[i];
+    if (i == this->count_ || std::isnan(v))
+      continue;
+    if (std::isnan(this->recent_min_) || v < this->recent_min_)
+      this->recent_min_ = v;
+    if (std::isnan(this->recent_max_) || v > this->recent_max_)
+      this->recent_max_ = v;
   }
 }
 
+float HistoryData::get_recent_max() const {
+  if (this->samples_.empty())
+    return NAN;
+  float current = this->samples_[this->count_];
+  if (std::isnan(this->recent_max_) || current > this->recent_max_)
+    return current;
+  return this->recent_max_;
+}
+
+float HistoryData::get_recent_min() const {
+  if (this->samples_.empty())
+    return NAN;
+  float current = this->samples_[this->count_];
+  if (std::isnan(this->recent_min_) || current < this->recent_min_)
+    return current;
+  return this->recent_min_;
+}
+
 void GraphTrace::init(Graph *g) {
   ESP_LOGI(TAG, "Init trace for sensor %s", this->get_name().c_str());
   this->data_.init(g->get_width());
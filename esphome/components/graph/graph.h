@@ -5,6 +5,7 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/core/color.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 
@@ -90,19 +91,30 @@ class HistoryData {
   void set_update_time_ms(uint32_t update_time_ms) { update_time_ = update_time_ms; }
   void take_sample(float data);
   int get_length() const { return length_; }
-  float get_value(int idx) const { return samples_[(count_ + length_ - 1 - idx) % length_]; }
-  float get_recent_max() const { return recent_max_; }
-  float get_recent_min() const { return recent_min_; }
+  /// Average of the samples in column idx, counted back from the most recent one.
+  float get_value(int idx) const { return this->samples_[(this->count_ + this->length_ - idx) % this->length_]; }
+  /// Extremes of the plotted values, so the y-axis range matches the trace.
+  float get_recent_max() const;
+  float get_recent_min() const;
 
  protected:
+  /// Start a new column, evicting the oldest one.
+  void advance_(float data);
+  /// Add a sample to the average of the current column.
+  void accumulate_(float data);
+  /// Rescan the completed columns, only needed when the column holding an extreme is evicted.
+  void recalc_recent_();
+
   uint32_t last_sample_;
   uint32_t period_{0};       /// in ms
   uint32_t update_time_{0};  /// in ms
   int length_;
-  int count_{0};
+  int count_{0};             /// index of the column currently being filled
+  uint16_t bucket_samples_{0};
+  /// Extremes of the completed columns; the current one is still changing and is compared when read.
   float recent_min_{NAN};
   float recent_max_{NAN};
-  std::vector<float> samples_;
+  std::vector<float, ExternalRAMAllocator<float>> samples_;
 };
 
 class GraphTrace {
@@ -1,5 +1,8 @@
 #include "i2c.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 namespace esphome {
@@ -41,6 +44,86 @@ ErrorCode I2CDevice::write_register16(uint16_t a_register, const uint8_t *data,
   return bus_->writev(address_, buffers, 2, stop);
 }
 
+void I2CDevice::queue_transaction(const uint8_t *write_data, size_t write_len, size_t read_len,
+                                  transaction_callback_t &&callback) {
+  I2CTransaction transaction;
+  transaction.device = this;
+  transaction.address = this->address_;
+  transaction.data.resize(write_len + read_len);
+  if (write_len > 0)
+    memcpy(transaction.data.data(), write_data, write_len);
+  transaction.write_len = write_len;
+  transaction.read_len = read_len;
+  transaction.callback = std::move(callback);
+  this->bus_->submit(std::move(transaction));
+}
+
+void I2CDevice::queue_write_register(uint8_t a_register, const uint8_t *data, size_t len,
+                                     transaction_callback_t &&callback) {
+  I2CTransaction transaction;
+  transaction.device = this;
+  transaction.address = this->address_;
+  transaction.data.resize(len + 1);
+  transaction.data[0] = a_register;
+  if (len > 0)
+    memcpy(&transaction.data[1], data, len);
+  transaction.write_len = len + 1;
+  transaction.callback = std::move(callback);
+  this->bus_->submit(std::move(transaction));
+}
+
+void I2CBus::process_queue_() {
+  if (this->queue_.empty())
+    return;
+  // callbacks may queue follow-up transactions, these are picked up on the next loop
+  this->processing_.swap(this->queue_);
+  // keep the submission order of each device but select each multiplexer channel only once
+  std::stable_sort(this->processing_.begin(), this->processing_.end(),
+                   [](const I2CTransaction &a, const I2CTransaction &b) { return a.bus < b.bus; });
+
+  I2CBus *current = nullptr;
+  ErrorCode batch_err = ERROR_OK;
+  for (auto &transaction : this->processing_) {
+    if (transaction.bus != current) {
+      if (current != nullptr)
+        current->end_batch();
+      current = transaction.bus;
+      batch_err = current->begin_batch();
+    }
+    uint32_t start = micros();
+    ErrorCode err = batch_err;
+    if (err == ERROR_OK && transaction.write_len > 0) {
+      err = current->write(transaction.address, transaction.data.data(), transaction.write_len,
+                           transaction.read_len == 0);
+    }
+    if (err == ERROR_OK && transaction.read_len > 0)
+      err = current->read(transaction.address, transaction.data.data() + transaction.write_len, transaction.read_len);
+    transaction.error = err;
+
+    if (transaction.device != nullptr) {
+      I2CStats &stats = transaction.device->stats_;
+      stats.transactions++;
+      stats.bus_time_us += micros() - start;
+      if (err == ERROR_NOT_ACKNOWLEDGED) {
+        stats.nacks++;
+      } else if (err != ERROR_OK) {
+        stats.errors++;
+      }
+    }
+    if (err != ERROR_OK)
+      ESP_LOGV(TAG, "Queued transaction to 0x%02X failed: %d", transaction.address, err);
+  }
+  if (current != nullptr)
+    current->end_batch();
+
+  // run the callbacks once every multiplexer channel has been released, they may access the bus directly
+  for (auto &transaction : this->processing_) {
+    if (transaction.callback)
+      transaction.callback(transaction.error, transaction.data.data() + transaction.write_len, transaction.read_len);
+  }
+  this->processing_.clear();
+}
+
 bool I2CDevice::read_bytes_16(uint8_t a_register, uint16_t *data, uint8_t len) {
   if (read_register(a_register, reinterpret_cast<uint8_t *>(data), len * 2) != ERROR_OK)
     return false;
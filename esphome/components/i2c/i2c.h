@@ -123,6 +123,14 @@ class I2CRegister16 {
   uint16_t register_;  ///< the internal 16 bits address of the register
 };
 
+/// @brief the I2CStats structure holds the statistics of the queued transactions of an I2CDevice
+struct I2CStats {
+  uint32_t transactions{0};  ///< number of executed transactions
+  uint32_t nacks{0};         ///< number of transactions that were not acknowledged
+  uint32_t errors{0};        ///< number of transactions that failed for another reason
+  uint32_t bus_time_us{0};   ///< total time spent on the bus, in microseconds
+};
+
 // like ntohs/htons but without including networking headers.
 // ("i2c" byte order is big-endian)
 inline uint16_t i2ctohs(uint16_t i2cshort) { return convert_big_endian(i2cshort); }
@@ -203,6 +211,34 @@ class I2CDevice {
   /// @return an i2c::ErrorCode
   ErrorCode write_register16(uint16_t a_register, const uint8_t *data, size_t len, bool stop = true);
 
+  /// @brief queues a transaction that writes bytes to the device and then reads bytes back with a repeated start
+  /// @param write_data pointer to an array that contains the bytes to send, copied into the transaction
+  /// @param write_len number of bytes to write (may be 0)
+  /// @param read_len number of bytes to read (may be 0)
+  /// @param callback called from the bus loop with the result and the bytes read
+  void queue_transaction(const uint8_t *write_data, size_t write_len, size_t read_len,
+                         transaction_callback_t &&callback);
+
+  /// @brief queues a read of an array of bytes from a specific register in the I²C device
+  /// @param a_register an 8 bits internal address of the I²C register to read from
+  /// @param len number of bytes to read
+  /// @param callback called from the bus loop with the result and the bytes read
+  void queue_read_register(uint8_t a_register, size_t len, transaction_callback_t &&callback) {
+    this->queue_transaction(&a_register, 1, len, std::move(callback));
+  }
+
+  /// @brief queues a write of an array of bytes to a specific register in the I²C device
+  /// @param a_register the internal address of the register to write to
+  /// @param data pointer to an array that contains the bytes to send, copied into the transaction
+  /// @param len number of bytes to write
+  /// @param callback (optional) called from the bus loop with the result
+  void queue_write_register(uint8_t a_register, const uint8_t *data, size_t len,
+                            transaction_callback_t &&callback = nullptr);
+
+  /// @brief statistics of the transactions queued by this device
+  /// @return an I2CStats reference
+  const I2CStats &get_i2c_stats() const { return this->stats_; }
+
   ///
   /// Compat APIs
   /// All methods below have been added for compatibility reasons. They do not bring any functionality and therefore on
@@ -268,6 +304,9 @@ class I2CDevice {
  protected:
   uint8_t address_{0x00};  ///< store the address of the device on the bus
   I2CBus *bus_{nullptr};   ///< pointer to I2CBus instance
+  I2CStats stats_{};       ///< statistics of the queued transactions
+
+  friend class I2CBus;
 };
 
 }  // namespace i2c
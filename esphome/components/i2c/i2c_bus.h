@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,28 @@ struct WriteBuffer {
   size_t len;           ///< length of the buffer
 };
 
+class I2CBus;
+class I2CDevice;
+
+/// @brief callback invoked once a queued transaction has been executed
+/// @param error the i2c::ErrorCode of the transaction
+/// @param data pointer to the bytes read (only valid during the callback)
+/// @param len number of bytes read
+using transaction_callback_t = std::function<void(ErrorCode error, const uint8_t *data, size_t len)>;
+
+/// @brief the I2CTransaction structure describes a queued transfer: an optional write followed by an optional read
+/// issued with a repeated start, e.g. a register read or a register write.
+struct I2CTransaction {
+  I2CDevice *device{nullptr};  ///< device that submitted the transaction, used for statistics
+  I2CBus *bus{nullptr};        ///< bus or multiplexer channel the transaction is executed on
+  uint8_t address{0};          ///< address of the I²C component on the bus
+  std::vector<uint8_t> data;   ///< write_len bytes to send followed by room for read_len received bytes
+  size_t write_len{0};         ///< number of bytes to write
+  size_t read_len{0};          ///< number of bytes to read
+  ErrorCode error{ERROR_OK};   ///< result, set when the transaction has been executed
+  transaction_callback_t callback;
+};
+
 /// @brief This Class provides the methods to read and write bytes from an I2CBus.
 /// @note The I2CBus virtual class follows a *Factory design pattern* that provides all the interfaces methods required
 /// by clients while deferring the actual implementation of these methods to a subclasses. I2C-bus specification and
@@ -91,7 +114,28 @@ class I2CBus {
   /// @details This is a pure virtual method that must be implemented in the subclass.
   virtual ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) = 0;
 
+  /// @brief Queues a transaction that is executed later from the loop of the root bus.
+  /// @param transaction the transaction to queue. When its bus is not set, it is executed on this bus.
+  /// @details Queued transactions are grouped by the bus they target, so a multiplexer channel is only selected
+  /// once for all transactions waiting on it instead of once per transaction.
+  virtual void submit(I2CTransaction &&transaction) {
+    if (transaction.bus == nullptr)
+      transaction.bus = this;
+    this->queue_.push_back(std::move(transaction));
+  }
+
+  /// @brief Called before a group of queued transactions is executed on this bus.
+  /// @return an i2c::ErrorCode, the transactions of the group fail with this error if it is not ERROR_OK
+  virtual ErrorCode begin_batch() { return ERROR_OK; }
+
+  /// @brief Called after a group of queued transactions has been executed on this bus.
+  virtual void end_batch() {}
+
  protected:
+  /// @brief Executes all queued transactions, grouped by target bus, then calls their callbacks. Must be called
+  /// from the loop of the root bus.
+  void process_queue_();
+
   /// @brief Scans the I2C bus for devices. Devices presence is kept in an array of std::pair
   /// that contains the address and the corresponding bool presence flag.
   void i2c_scan_() {
@@ -106,6 +150,8 @@ class I2CBus {
   }
   std::vector<std::pair<uint8_t, bool>> scan_results_;  ///< array containing scan results
   bool scan_{false};                                    ///< Should we scan ? Can be set in the yaml
+  std::vector<I2CTransaction> queue_;                   ///< transactions waiting to be executed
+  std::vector<I2CTransaction> processing_;              ///< transactions being executed by process_queue_()
 };
 
 }  // namespace i2c
@@ -67,6 +67,17 @@ void ArduinoI2CBus::set_pins_and_clock_() {
   wire_->setClock(frequency_);
 }
 
+void ArduinoI2CBus::loop() {
+  this->process_queue_();
+  // callbacks may have queued follow-up transactions
+  if (this->queue_.empty())
+    this->disable_loop();
+}
+void ArduinoI2CBus::submit(I2CTransaction &&transaction) {
+  I2CBus::submit(std::move(transaction));
+  this->enable_loop();
+}
+
 void ArduinoI2CBus::dump_config() {
   ESP_LOGCONFIG(TAG, "I2C Bus:");
   ESP_LOGCONFIG(TAG, "  SDA Pin: GPIO%u", this->sda_pin_);
@@ -71,6 +71,16 @@ void IDFI2CBus::setup() {
     this->i2c_scan_();
   }
 }
+void IDFI2CBus::loop() {
+  this->process_queue_();
+  // callbacks may have queued follow-up transactions
+  if (this->queue_.empty())
+    this->disable_loop();
+}
+void IDFI2CBus::submit(I2CTransaction &&transaction) {
+  I2CBus::submit(std::move(transaction));
+  this->enable_loop();
+}
 void IDFI2CBus::dump_config() {
   ESP_LOGCONFIG(TAG, "I2C Bus:");
   ESP_LOGCONFIG(TAG, "  SDA Pin: GPIO%u", this->sda_pin_);
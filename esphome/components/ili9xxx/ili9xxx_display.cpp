@@ -9,12 +9,8 @@ namespace ili9xxx {
 
 static const uint16_t SPI_SETUP_US = 100;         // estimated fixed overhead in microseconds for an SPI write
 static const uint16_t SPI_MAX_BLOCK_SIZE = 4092;  // Max size of continuous SPI transfer
-
-// store a 16 bit value in a buffer, big endian.
-static inline void put16_be(uint8_t *buf, uint16_t value) {
-  buf[0] = value >> 8;
-  buf[1] = value;
-}
+// size of each of the converted row buffers, big enough to keep the number of transfers of 18 bit displays down
+static const size_t CONVERTED_BUFFER_SIZE = ILI9XXX_TRANSFER_BUFFER_SIZE * 4;
 
 void ILI9XXXDisplay::set_madctl() {
   // custom x/y transform and color order
@@ -218,6 +214,7 @@ void ILI9XXXDisplay::update() {
     this->do_update_();
   } while (this->need_update_);
   this->prossing_update_ = false;
+  this->wait_draw_complete();
   this->display_();
 }
 
@@ -235,7 +232,8 @@ void ILI9XXXDisplay::display_() {
   // estimate time for a single write
   size_t sw_time = this->width_ * h * 16 / mhz + this->width_ * h * 2 / SPI_MAX_BLOCK_SIZE * SPI_SETUP_US * 2;
   // estimate time for multiple writes
-  size_t mw_time = (w * h * 16) / mhz + w * h * 2 / ILI9XXX_TRANSFER_BUFFER_SIZE * SPI_SETUP_US;
+  size_t const out_bpp = this->is_18bitdisplay_ ? 3 : 2;
+  size_t mw_time = (w * h * out_bpp * 8) / mhz + w * h * out_bpp / CONVERTED_BUFFER_SIZE * SPI_SETUP_US;
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
@@ -249,50 +247,27 @@ void ILI9XXXDisplay::display_() {
     this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
-    uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
-    size_t rem = h * w;  // remaining number of pixels to write
     set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
-    size_t idx = 0;    // index into transfer_buffer
-    size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
-    while (rem-- != 0) {
-      uint16_t color_val;
-      switch (this->buffer_color_mode_) {
-        case BITS_8:
-          color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
-          break;
-        case BITS_8_INDEXED:
-          color_val = display::ColorUtil::color_to_565(
-              display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
-          break;
-        default:  // case BITS_16:
-          color_val = (this->buffer_[pos * 2] << 8) + this->buffer_[pos * 2 + 1];
-          pos++;
-          break;
-      }
-      if (this->is_18bitdisplay_) {
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
-        transfer_buffer[idx++] = (uint8_t) (color_val << 3);             // Red
-      } else {
-        put16_be(transfer_buffer + idx, color_val);
-        idx += 2;
-      }
-      if (idx == sizeof(transfer_buffer)) {
-        this->write_array(transfer_buffer, idx);
-        idx = 0;
-        App.feed_wdt();
-      }
-      // end of line? Skip to the next.
-      if (++pixel == w) {
-        pixel = 0;
-        pos += this->width_ - w;
-      }
-    }
-    // flush any balance.
-    if (idx != 0) {
-      this->write_array(transfer_buffer, idx);
+    // pick the conversion kernel once for the whole flush
+    display::PixelRowConverter converter;
+    const uint16_t *lut = nullptr;
+    size_t bpp = 1;  // bytes per pixel in the buffer
+    switch (this->buffer_color_mode_) {
+      case BITS_8:
+        lut = display::get_rgb332_to_565_lut();
+        converter = this->is_18bitdisplay_ ? display::convert_row_lut8_to_666 : display::convert_row_lut8_to_565be;
+        break;
+      case BITS_8_INDEXED:
+        lut = this->get_palette_lut_();
+        converter = this->is_18bitdisplay_ ? display::convert_row_lut8_to_666 : display::convert_row_lut8_to_565be;
+        break;
+      default:  // case BITS_16:
+        bpp = 2;
+        converter = this->is_18bitdisplay_ ? display::convert_row_565be_to_666 : display::convert_row_565be_to_565be;
+        break;
     }
+    this->write_converted_rows_(this->buffer_ + (this->y_low_ * this->width_ + this->x_low_) * bpp, w, h,
+                                this->width_ * bpp, bpp, converter, lut);
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
@@ -303,6 +278,45 @@ void ILI9XXXDisplay::display_() {
   this->y_high_ = 0;
 }
 
+void ILI9XXXDisplay::write_converted_rows_(const uint8_t *src, size_t w, size_t h, size_t stride, size_t bpp,
+                                           display::PixelRowConverter converter, const uint16_t *lut) {
+  // double buffered: one buffer is converted while the other one is being sent
+  uint8_t transfer_buffers[2][CONVERTED_BUFFER_SIZE];
+  uint8_t *transfer_buffer = transfer_buffers[0];
+  size_t const out_bpp = this->is_18bitdisplay_ ? 3 : 2;
+  size_t idx = 0;  // index into transfer_buffer
+  for (size_t y = 0; y != h; y++, src += stride) {
+    const uint8_t *row = src;
+    size_t rem = w;  // remaining number of pixels in this row
+    while (rem != 0) {
+      size_t const count = std::min(rem, (CONVERTED_BUFFER_SIZE - idx) / out_bpp);
+      converter(row, transfer_buffer + idx, count, lut);
+      row += count * bpp;
+      rem -= count;
+      idx += count * out_bpp;
+      if (idx == CONVERTED_BUFFER_SIZE) {
+        this->write_array_async(transfer_buffer, idx);
+        transfer_buffer = transfer_buffer == transfer_buffers[0] ? transfer_buffers[1] : transfer_buffers[0];
+        // the previous write from the buffer we switched to must be done before it is refilled
+        this->wait_write_complete(1);
+        idx = 0;
+        App.feed_wdt();
+      }
+    }
+  }
+  // flush any balance.
+  if (idx != 0)
+    this->write_array(transfer_buffer, idx);
+}
+
+const uint16_t *ILI9XXXDisplay::get_palette_lut_() {
+  if (this->palette_lut_.empty()) {
+    this->palette_lut_.resize(256);
+    display::fill_palette888_to_565_lut(this->palette_, this->palette_lut_.data());
+  }
+  return this->palette_lut_.data();
+}
+
 // note that this bypasses the buffer and writes directly to the display.
 void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr,
                                     display::ColorOrder order, display::ColorBitness bitness, bool big_endian,
@@ -312,55 +326,82 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
   // if color mapping or software rotation is required, hand this off to the parent implementation. This will
   // do color conversion pixel-by-pixel into the buffer and draw it later. If this is happening the user has not
   // configured the renderer well.
-  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || !big_endian) {
+  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565) {
     return display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset, y_offset,
                                             x_pad);
   }
   this->set_addr_window_(x_start, y_start, x_start + w - 1, y_start + h - 1);
   // x_ and y_offset are offsets into the source buffer, unrelated to our own offsets into the display.
   auto stride = x_offset + w + x_pad;
-  if (!this->is_18bitdisplay_) {
+  if (!this->is_18bitdisplay_ && big_endian) {
     if (x_offset == 0 && x_pad == 0 && y_offset == 0) {
       // we could deal here with a non-zero y_offset, but if x_offset is zero, y_offset probably will be so don't bother
       this->write_array(ptr, w * h * 2);
     } else {
+      // the source stays untouched until end_data_(), so all rows can be queued back to back
       for (size_t y = 0; y != h; y++) {
-        this->write_array(ptr + (y + y_offset) * stride + x_offset, w * 2);
+        this->write_array_async(ptr + ((y + y_offset) * stride + x_offset) * 2, w * 2);
       }
     }
   } else {
-    // 18 bit mode
-    uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE * 4];
-    ESP_LOGV(TAG, "Doing multiple write");
-    size_t rem = h * w;  // remaining number of pixels to write
-    size_t idx = 0;      // index into transfer_buffer
-    size_t pixel = 0;    // pixel number offset
-    ptr += (y_offset * stride + x_offset) * 2;
-    while (rem-- != 0) {
-      uint8_t hi_byte = *ptr++;
-      uint8_t lo_byte = *ptr++;
-      transfer_buffer[idx++] = hi_byte & 0xF8;                     // Blue
-      transfer_buffer[idx++] = ((hi_byte << 5) | (lo_byte) >> 5);  // Green
-      transfer_buffer[idx++] = lo_byte << 3;                       // Red
-      if (idx == sizeof(transfer_buffer)) {
-        this->write_array(transfer_buffer, idx);
-        idx = 0;
-        App.feed_wdt();
-      }
-      // end of line? Skip to the next.
-      if (++pixel == w) {
-        pixel = 0;
-        ptr += (x_pad + x_offset) * 2;
-      }
-    }
-    // flush any balance.
-    if (idx != 0) {
-      this->write_array(transfer_buffer, idx);
+    display::PixelRowConverter converter;
+    if (this->is_18bitdisplay_) {
+      converter = big_endian ? display::convert_row_565be_to_666 : display::convert_row_565le_to_666;
+    } else {
+      converter = display::convert_row_565le_to_565be;
     }
+    this->write_converted_rows_(ptr + (y_offset * stride + x_offset) * 2, w, h, stride * 2, 2, converter, nullptr);
+  }
+  this->end_data_();
+}
+
+bool ILI9XXXDisplay::draw_pixels_at_async(int x_start, int y_start, int w, int h, const uint8_t *ptr,
+                                          display::ColorOrder order, display::ColorBitness bitness, bool big_endian) {
+  // only pixels that can be sent as they are go out in the background
+  if (w <= 0 || h <= 0 || this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES ||
+      bitness != display::COLOR_BITNESS_565 || this->is_18bitdisplay_ || !big_endian) {
+    this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
+    return false;
   }
+  this->wait_draw_complete();
+  this->set_addr_window_(x_start, y_start, x_start + w - 1, y_start + h - 1);
+  this->write_array_async(ptr, w * h * 2);
+  // the data phase is ended, and the bus released, in wait_draw_complete()
+  this->draw_pending_ = true;
+  return true;
+}
+
+void ILI9XXXDisplay::wait_draw_complete() {
+  if (!this->draw_pending_)
+    return;
+  this->draw_pending_ = false;
   this->end_data_();
 }
 
+void ILI9XXXDisplay::draw_pixel_row_at(int x_start, int y, int w, const uint8_t *ptr, display::ColorOrder order,
+                                       display::ColorBitness bitness, bool big_endian) {
+  // a row that already matches the buffer format is copied as a whole, anything else goes pixel by pixel
+  if (w <= 0 || this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || this->buffer_color_mode_ != BITS_16 ||
+      bitness != display::COLOR_BITNESS_565 || order != display::COLOR_ORDER_RGB || !big_endian) {
+    return display::DisplayBuffer::draw_pixel_row_at(x_start, y, w, ptr, order, bitness, big_endian);
+  }
+  if (!this->check_buffer_())
+    return;
+  uint8_t *dst = this->buffer_ + (y * this->width_ + x_start) * 2;
+  if (memcmp(dst, ptr, w * 2) == 0)
+    return;
+  memcpy(dst, ptr, w * 2);
+  // low and high watermark may speed up drawing from buffer
+  if (x_start < this->x_low_)
+    this->x_low_ = x_start;
+  if (y < this->y_low_)
+    this->y_low_ = y;
+  if (x_start + w - 1 > this->x_high_)
+    this->x_high_ = x_start + w - 1;
+  if (y > this->y_high_)
+    this->y_high_ = y;
+}
+
 // should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
 // values per bit is huge
 uint32_t ILI9XXXDisplay::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal(); }
@@ -63,7 +63,10 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   void set_dc_pin(GPIOPin *dc_pin) { dc_pin_ = dc_pin; }
   float get_setup_priority() const override;
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
-  void set_palette(const uint8_t *palette) { this->palette_ = palette; }
+  void set_palette(const uint8_t *palette) {
+    this->palette_ = palette;
+    this->palette_lut_.clear();
+  }
   void set_buffer_color_mode(ILI9XXXColorMode color_mode) { this->buffer_color_mode_ = color_mode; }
   void set_dimensions(int16_t width, int16_t height) {
     this->height_ = height;
@@ -93,6 +96,11 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
                       display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
+  void draw_pixel_row_at(int x_start, int y, int w, const uint8_t *ptr, display::ColorOrder order,
+                         display::ColorBitness bitness, bool big_endian) override;
+  bool draw_pixels_at_async(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
+                            display::ColorBitness bitness, bool big_endian) override;
+  void wait_draw_complete() override;
 
  protected:
   inline bool check_buffer_() {
@@ -108,6 +116,9 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
 
   virtual void set_madctl();
   void display_();
+  void write_converted_rows_(const uint8_t *src, size_t w, size_t h, size_t stride, size_t bpp,
+                             display::PixelRowConverter converter, const uint16_t *lut);
+  const uint16_t *get_palette_lut_();
   void init_lcd_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -123,6 +134,7 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   uint16_t x_high_{0};
   uint16_t y_high_{0};
   const uint8_t *palette_{};
+  std::vector<uint16_t> palette_lut_;  ///< RGB565 values of the palette, built on first use
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
 
@@ -149,6 +161,7 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   bool swap_xy_{};
   bool mirror_x_{};
   bool mirror_y_{};
+  bool draw_pending_{};  ///< A draw_pixels_at_async() transfer still holds the bus.
 };
 
 //-----------   M5Stack display --------------
@@ -45,6 +45,13 @@ IMAGE_TYPE = {
     "RGBA": ImageType.IMAGE_TYPE_RGBA,
 }
 
+ImageCompression = image_ns.enum("ImageCompression")
+IMAGE_COMPRESSION = {
+    "NONE": ImageCompression.IMAGE_COMPRESSION_NONE,
+    "RLE": ImageCompression.IMAGE_COMPRESSION_RLE,
+}
+
+CONF_COMPRESSION = "compression"
 CONF_USE_TRANSPARENCY = "use_transparency"
 
 # If the MDI file cannot be downloaded within this time, abort.
@@ -141,6 +148,12 @@ def validate_cross_dependencies(config):
     if is_mdi and config[CONF_TYPE] not in ["BINARY", "TRANSPARENT_BINARY"]:
         raise cv.Invalid("MDI images must be binary images.")
 
+    if config.get(CONF_COMPRESSION, "NONE") != "NONE" and image_type in [
+        "BINARY",
+        "TRANSPARENT_BINARY",
+    ]:
+        raise cv.Invalid("Binary images cannot be compressed.")
+
     return config
 
 
@@ -227,6 +240,9 @@ IMAGE_SCHEMA = cv.Schema(
             cv.Optional(CONF_DITHER, default="NONE"): cv.one_of(
                 "NONE", "FLOYDSTEINBERG", upper=True
             ),
+            cv.Optional(CONF_COMPRESSION, default="NONE"): cv.enum(
+                IMAGE_COMPRESSION, upper=True
+            ),
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         },
         validate_cross_dependencies,
@@ -257,6 +273,56 @@ def load_svg_image(file: bytes, resize: tuple[int, int]):
     return Image.open(io.BytesIO(svg_image))
 
 
+RLE_RUN = 0x80
+RLE_MAX_COUNT = 0x80
+
+
+def rle_encode(data: list[int], width: int, height: int, bytes_per_pixel: int):
+    """
+    Run-length encode pixel data row by row, so each row can be decoded on its own.
+    A header byte with the top bit set is followed by one pixel to be repeated
+    (header & 0x7F) + 1 times, any other header byte by header + 1 literal pixels.
+    """
+    # A run of two pixels only pays off when a pixel is wider than the header byte.
+    min_run = 2 if bytes_per_pixel > 1 else 3
+    encoded = []
+    row_stride = width * bytes_per_pixel
+    for y in range(height):
+        row = data[y * row_stride : (y + 1) * row_stride]
+        pixels = [
+            tuple(row[x * bytes_per_pixel : (x + 1) * bytes_per_pixel])
+            for x in range(width)
+        ]
+        literal = []
+
+        def flush_literal():
+            if literal:
+                encoded.append(len(literal) - 1)
+                for pixel in literal:
+                    encoded.extend(pixel)
+                literal.clear()
+
+        x = 0
+        while x < width:
+            run = 1
+            while (
+                x + run < width and run < RLE_MAX_COUNT and pixels[x + run] == pixels[x]
+            ):
+                run += 1
+            if run >= min_run:
+                flush_literal()
+                encoded.append(RLE_RUN | (run - 1))
+                encoded.extend(pixels[x])
+            else:
+                run = 1
+                literal.append(pixels[x])
+                if len(literal) == RLE_MAX_COUNT:
+                    flush_literal()
+            x += run
+        flush_literal()
+    return encoded
+
+
 async def to_code(config):
     # Local import only to allow "validate_pillow_installed" to run *before* importing it
     from PIL import Image
@@ -404,9 +470,28 @@ async def to_code(config):
             f"Image f{config[CONF_ID]} has an unsupported type: {config[CONF_TYPE]}."
         )
 
+    compression = config[CONF_COMPRESSION]
+    if compression == "RLE":
+        encoded = rle_encode(data, width, height, len(data) // (width * height))
+        _LOGGER.debug(
+            "%s RLE compressed from %d to %d bytes",
+            config[CONF_ID],
+            len(data),
+            len(encoded),
+        )
+        if len(encoded) < len(data):
+            data = encoded
+        else:
+            _LOGGER.info(
+                "Image %s does not compress, storing it uncompressed", config[CONF_ID]
+            )
+            compression = "NONE"
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
         config[CONF_ID], prog_arr, width, height, IMAGE_TYPE[config[CONF_TYPE]]
     )
     cg.add(var.set_transparency(transparent))
+    if compression != "NONE":
+        cg.add(var.set_compression(IMAGE_COMPRESSION[compression]))
@@ -1,64 +1,146 @@
 #include "image.h"
 
+#include <algorithm>
+
 #include "esphome/core/hal.h"
 
 namespace esphome {
 namespace image {
 
+static const uint8_t RLE_RUN = 0x80;
+
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
-  switch (type_) {
-    case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
+  // Only walk the part of the image that ends up on the display.
+  int x_start = std::max(0, -x);
+  int y_start = std::max(0, -y);
+  int x_end = std::min(this->width_, display->get_width() - x);
+  int y_end = std::min(this->height_, display->get_height() - y);
+  auto clipping = display->get_clipping();
+  if (clipping.is_set()) {
+    // like Rect::inside(), treat the far edges of the clipping region as inside
+    x_start = std::max(x_start, clipping.x - x);
+    y_start = std::max(y_start, clipping.y - y);
+    x_end = std::min(x_end, clipping.x2() + 1 - x);
+    y_end = std::min(y_end, clipping.y2() + 1 - y);
+  }
+  if (x_start >= x_end || y_start >= y_end)
+    return;
+
+  if (this->type_ == IMAGE_TYPE_BINARY) {
+    for (int img_y = y_start; img_y != y_end; img_y++) {
+      for (int img_x = x_start; img_x != x_end; img_x++) {
+        if (this->get_binary_pixel_(img_x, img_y)) {
+          display->draw_pixel_at(x + img_x, y + img_y, color_on);
+        } else if (!this->transparent_) {
+          display->draw_pixel_at(x + img_x, y + img_y, color_off);
         }
       }
-      break;
     }
-    case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
+    return;
+  }
+
+  const size_t bytes_per_pixel = image_type_to_bpp(this->type_) / 8;
+  const int w = x_end - x_start;
+  if (this->compression_ == IMAGE_COMPRESSION_RLE) {
+    // rows can only be found by decoding the ones before them
+    this->row_buffer_.resize(this->width_ * bytes_per_pixel);
+    const uint8_t *src = this->data_start_;
+    for (int img_y = 0; img_y != y_start; img_y++)
+      src = this->decode_rle_row_(src, nullptr);
+    for (int img_y = y_start; img_y != y_end; img_y++) {
+      src = this->decode_rle_row_(src, this->row_buffer_.data());
+      this->draw_row_(x + x_start, y + img_y, w, this->row_buffer_.data() + x_start * bytes_per_pixel, display);
+    }
+    return;
+  }
+  const size_t row_len = w * bytes_per_pixel;
+  this->row_buffer_.resize(row_len);
+  for (int img_y = y_start; img_y != y_end; img_y++) {
+    const uint8_t *src = this->data_start_ + (img_y * this->width_ + x_start) * bytes_per_pixel;
+    for (size_t i = 0; i != row_len; i++)
+      this->row_buffer_[i] = progmem_read_byte(src + i);
+    this->draw_row_(x + x_start, y + img_y, w, this->row_buffer_.data(), display);
+  }
+}
+void Image::draw_row_(int x, int y, int w, const uint8_t *row, display::Display *display) {
+  if (this->type_ == IMAGE_TYPE_RGB565) {
+    // RGB565 is what most color displays use natively, so hand over each run of visible pixels as a whole.
+    int run_start = 0;
+    for (int i = 0; i != w; i++) {
+      if (this->transparent_ && row[i * 2] == 0x00 && row[i * 2 + 1] == 0x20) {
+        if (i != run_start) {
+          display->draw_pixel_row_at(x + run_start, y, i - run_start, row + run_start * 2, display::COLOR_ORDER_RGB,
+                                     display::COLOR_BITNESS_565, true);
         }
+        run_start = i + 1;
       }
-      break;
-    case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
+    }
+    if (w != run_start) {
+      display->draw_pixel_row_at(x + run_start, y, w - run_start, row + run_start * 2, display::COLOR_ORDER_RGB,
+                                 display::COLOR_BITNESS_565, true);
+    }
+    return;
+  }
+  const size_t bytes_per_pixel = image_type_to_bpp(this->type_) / 8;
+  for (int i = 0; i != w; i++, row += bytes_per_pixel) {
+    Color color;
+    switch (this->type_) {
+      case IMAGE_TYPE_GRAYSCALE:
+        color = this->get_grayscale_pixel_(row);
+        break;
+      case IMAGE_TYPE_RGB24:
+        color = this->get_rgb24_pixel_(row);
+        break;
+      case IMAGE_TYPE_RGBA:
+        color = this->get_rgba_pixel_(row);
+        break;
+      default:
+        return;
+    }
+    if (color.w >= 0x80) {
+      display->draw_pixel_at(x + i, y, color);
+    }
+  }
+}
+const uint8_t *Image::decode_rle_row_(const uint8_t *src, uint8_t *dst) const {
+  const size_t bytes_per_pixel = image_type_to_bpp(this->type_) / 8;
+  for (int x = 0; x < this->width_;) {
+    const uint8_t header = progmem_read_byte(src++);
+    const int count = (header & ~RLE_RUN) + 1;
+    if (header & RLE_RUN) {
+      if (dst != nullptr) {
+        for (int i = 0; i != count; i++) {
+          for (size_t b = 0; b != bytes_per_pixel; b++)
+            *dst++ = progmem_read_byte(src + b);
         }
       }
-      break;
-    case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+      src += bytes_per_pixel;
+    } else {
+      const size_t len = count * bytes_per_pixel;
+      if (dst != nullptr) {
+        for (size_t i = 0; i != len; i++)
+          *dst++ = progmem_read_byte(src + i);
       }
-      break;
+      src += len;
+    }
+    x += count;
+  }
+  return src;
+}
+const uint8_t *Image::get_pixel_ptr_(int x, int y) const {
+  const size_t bytes_per_pixel = image_type_to_bpp(this->type_) / 8;
+  if (this->compression_ != IMAGE_COMPRESSION_RLE)
+    return this->data_start_ + (x + y * this->width_) * bytes_per_pixel;
+  const uint8_t *src = this->data_start_;
+  for (int img_y = 0; img_y != y; img_y++)
+    src = this->decode_rle_row_(src, nullptr);
+  for (int img_x = 0;;) {
+    const uint8_t header = progmem_read_byte(src++);
+    const int count = (header & ~RLE_RUN) + 1;
+    if (x < img_x + count)
+      return (header & RLE_RUN) ? src : src + (x - img_x) * bytes_per_pixel;
+    src += (header & RLE_RUN) ? bytes_per_pixel : count * bytes_per_pixel;
+    img_x += count;
   }
 }
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
@@ -68,13 +150,13 @@ Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
     case IMAGE_TYPE_BINARY:
       return this->get_binary_pixel_(x, y) ? color_on : color_off;
     case IMAGE_TYPE_GRAYSCALE:
-      return this->get_grayscale_pixel_(x, y);
+      return this->get_grayscale_pixel_(this->get_pixel_ptr_(x, y));
     case IMAGE_TYPE_RGB565:
-      return this->get_rgb565_pixel_(x, y);
+      return this->get_rgb565_pixel_(this->get_pixel_ptr_(x, y));
     case IMAGE_TYPE_RGB24:
-      return this->get_rgb24_pixel_(x, y);
+      return this->get_rgb24_pixel_(this->get_pixel_ptr_(x, y));
     case IMAGE_TYPE_RGBA:
-      return this->get_rgba_pixel_(x, y);
+      return this->get_rgba_pixel_(this->get_pixel_ptr_(x, y));
     default:
       return color_off;
   }
@@ -84,15 +166,12 @@ bool Image::get_binary_pixel_(int x, int y) const {
   const uint32_t pos = x + y * width_8;
   return progmem_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
 }
-Color Image::get_rgba_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 4;
-  return Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-               progmem_read_byte(this->data_start_ + pos + 2), progmem_read_byte(this->data_start_ + pos + 3));
+Color Image::get_rgba_pixel_(const uint8_t *pixel) const {
+  return Color(progmem_read_byte(pixel + 0), progmem_read_byte(pixel + 1), progmem_read_byte(pixel + 2),
+               progmem_read_byte(pixel + 3));
 }
-Color Image::get_rgb24_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 3;
-  Color color = Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-                      progmem_read_byte(this->data_start_ + pos + 2));
+Color Image::get_rgb24_pixel_(const uint8_t *pixel) const {
+  Color color = Color(progmem_read_byte(pixel + 0), progmem_read_byte(pixel + 1), progmem_read_byte(pixel + 2));
   if (color.b == 1 && color.r == 0 && color.g == 0 && transparent_) {
     // (0, 0, 1) has been defined as transparent color for non-alpha images.
     // putting blue == 1 as a first condition for performance reasons (least likely value to short-cut the if)
@@ -102,10 +181,8 @@ Color Image::get_rgb24_pixel_(int x, int y) const {
   }
   return color;
 }
-Color Image::get_rgb565_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 2;
-  uint16_t rgb565 =
-      progmem_read_byte(this->data_start_ + pos + 0) << 8 | progmem_read_byte(this->data_start_ + pos + 1);
+Color Image::get_rgb565_pixel_(const uint8_t *pixel) const {
+  uint16_t rgb565 = progmem_read_byte(pixel + 0) << 8 | progmem_read_byte(pixel + 1);
   auto r = (rgb565 & 0xF800) >> 11;
   auto g = (rgb565 & 0x07E0) >> 5;
   auto b = rgb565 & 0x001F;
@@ -118,9 +195,8 @@ Color Image::get_rgb565_pixel_(int x, int y) const {
   }
   return color;
 }
-Color Image::get_grayscale_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_);
-  const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+Color Image::get_grayscale_pixel_(const uint8_t *pixel) const {
+  const uint8_t gray = progmem_read_byte(pixel);
   uint8_t alpha = (gray == 1 && transparent_) ? 0 : 0xFF;
   return Color(gray, gray, gray, alpha);
 }
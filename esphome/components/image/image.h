@@ -1,4 +1,5 @@
 #pragma once
+#include <vector>
 #include "esphome/core/color.h"
 #include "esphome/components/display/display_buffer.h"
 
@@ -13,6 +14,13 @@ enum ImageType {
   IMAGE_TYPE_RGBA = 4,
 };
 
+enum ImageCompression {
+  IMAGE_COMPRESSION_NONE = 0,
+  /// Each row is a sequence of runs: a header byte with the top bit set is followed by one pixel repeated
+  /// (header & 0x7F) + 1 times, any other header byte by header + 1 literal pixels.
+  IMAGE_COMPRESSION_RLE = 1,
+};
+
 inline int image_type_to_bpp(ImageType type) {
   switch (type) {
     case IMAGE_TYPE_BINARY:
@@ -45,18 +53,31 @@ class Image : public display::BaseImage {
   void set_transparency(bool transparent) { transparent_ = transparent; }
   bool has_transparency() const { return transparent_; }
 
+  void set_compression(ImageCompression compression) { compression_ = compression; }
+  ImageCompression get_compression() const { return compression_; }
+
  protected:
+  /// Draw one decoded row of a non-binary image, skipping transparent pixels.
+  void draw_row_(int x, int y, int w, const uint8_t *row, display::Display *display);
+  /// Decode one RLE compressed row into dst (or just skip it if dst is null), returns the start of the next row.
+  const uint8_t *decode_rle_row_(const uint8_t *src, uint8_t *dst) const;
+  /// Address of the encoded pixel at x, y of a non-binary image.
+  const uint8_t *get_pixel_ptr_(int x, int y) const;
+
   bool get_binary_pixel_(int x, int y) const;
-  Color get_rgb24_pixel_(int x, int y) const;
-  Color get_rgba_pixel_(int x, int y) const;
-  Color get_rgb565_pixel_(int x, int y) const;
-  Color get_grayscale_pixel_(int x, int y) const;
+  Color get_rgb24_pixel_(const uint8_t *pixel) const;
+  Color get_rgba_pixel_(const uint8_t *pixel) const;
+  Color get_rgb565_pixel_(const uint8_t *pixel) const;
+  Color get_grayscale_pixel_(const uint8_t *pixel) const;
 
   int width_;
   int height_;
   ImageType type_;
   const uint8_t *data_start_;
   bool transparent_;
+  ImageCompression compression_{IMAGE_COMPRESSION_NONE};
+  /// Holds the row being drawn, so the display gets it from RAM and in one piece.
+  std::vector<uint8_t> row_buffer_;
 };
 
 }  // namespace image
@@ -46,6 +46,8 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_DITHER_BITS = "dither_bits"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -98,6 +100,7 @@ BINARY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend(
 BRIGHTNESS_ONLY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend(
     {
         cv.Optional(CONF_GAMMA_CORRECT, default=2.8): cv.positive_float,
+        cv.Optional(CONF_DITHER_BITS): cv.int_range(min=1, max=16),
         cv.Optional(
             CONF_DEFAULT_TRANSITION_LENGTH, default="1s"
         ): cv.positive_time_period_milliseconds,
@@ -122,6 +125,9 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend(
             [cv.percentage], cv.Length(min=3, max=4)
         ),
         cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+        cv.Optional(CONF_DITHER_BITS): cv.invalid(
+            "Temporal dithering is not supported for addressable lights"
+        ),
     }
 )
 
@@ -155,6 +161,8 @@ async def setup_light_core_(light_var, output_var, config):
         cg.add(light_var.set_flash_transition_length(flash_transition_length))
     if (gamma_correct := config.get(CONF_GAMMA_CORRECT)) is not None:
         cg.add(light_var.set_gamma_correct(gamma_correct))
+    if (dither_bits := config.get(CONF_DITHER_BITS)) is not None:
+        cg.add(light_var.set_dither_bits(dither_bits))
     effects = await cg.build_registry_list(
         EFFECTS_REGISTRY, config.get(CONF_EFFECTS, [])
     )
@@ -8,7 +8,7 @@ namespace light {
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
-    auto corrected = to_uint8_scale(gamma_correct(i / 255.0f, gamma));
+    auto corrected = to_uint8_scale(gamma_correct_table(i / 255.0f, gamma));
     this->gamma_table_[i] = corrected;
   }
   if (gamma == 0.0f) {
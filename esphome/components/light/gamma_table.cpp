@@ -0,0 +1,38 @@
+#include "gamma_table.h"
+#include <cmath>
+#include <vector>
+
+namespace esphome {
+namespace light {
+
+GammaTable::GammaTable(float gamma) : gamma_(gamma) {
+  for (uint16_t i = 0; i <= SEGMENTS; i++)
+    this->table_[i] = static_cast<uint16_t>(roundf(powf(i / float(SEGMENTS), gamma) * 65535.0f));
+}
+
+const GammaTable *GammaTable::get(float gamma) {
+  if (gamma <= 0.0f)
+    return nullptr;
+  // Tables are never freed; there is normally only one gamma value in use
+  static std::vector<GammaTable *> tables;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  for (auto *table : tables) {
+    if (table->gamma_ == gamma)
+      return table;
+  }
+  auto *table = new GammaTable(gamma);  // NOLINT(cppcoreguidelines-owning-memory)
+  tables.push_back(table);
+  return table;
+}
+
+float gamma_correct_table(float value, float gamma) {
+  // Consecutive calls almost always use the same gamma, skip the lookup for those
+  static const GammaTable *last = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  if (gamma <= 0.0f)
+    return value <= 0.0f ? 0.0f : value;
+  if (last == nullptr || last->get_gamma() != gamma)
+    last = GammaTable::get(gamma);
+  return last->correct(value);
+}
+
+}  // namespace light
+}  // namespace esphome
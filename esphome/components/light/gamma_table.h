@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace light {
+
+/** Interpolated lookup table for value^gamma, shared between all lights using the same gamma.
+ *
+ * 256 linearly interpolated segments of 16-bit samples stay within one 16-bit step of powf() for the usual
+ * gamma values, which is enough for high-resolution PWM outputs while avoiding a powf() per channel per write.
+ */
+class GammaTable {
+ public:
+  static const uint16_t SEGMENTS = 256;
+
+  /// Get the table for gamma, creating it on first use. Returns nullptr for gamma <= 0 (no correction).
+  static const GammaTable *get(float gamma);
+
+  float get_gamma() const { return this->gamma_; }
+
+  /// Gamma correct value (0.0 to 1.0).
+  float correct(float value) const {
+    if (value <= 0.0f)
+      return 0.0f;
+    if (value >= 1.0f)
+      return 1.0f;
+    const float pos = value * SEGMENTS;
+    const uint16_t index = static_cast<uint16_t>(pos);
+    const float frac = pos - index;
+    const float low = this->table_[index];
+    const float high = this->table_[index + 1];
+    return (low + (high - low) * frac) * (1.0f / 65535.0f);
+  }
+
+ protected:
+  explicit GammaTable(float gamma);
+
+  float gamma_;
+  uint16_t table_[SEGMENTS + 1];
+};
+
+/// Same as gamma_correct(), but looked up in the shared table for gamma.
+float gamma_correct_table(float value, float gamma);
+
+}  // namespace light
+}  // namespace esphome
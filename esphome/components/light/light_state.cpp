@@ -104,6 +104,9 @@ void LightState::dump_config() {
   if (this->get_traits().supports_color_capability(ColorCapability::BRIGHTNESS)) {
     ESP_LOGCONFIG(TAG, "  Default Transition Length: %.1fs", this->default_transition_length_ / 1e3f);
     ESP_LOGCONFIG(TAG, "  Gamma Correct: %.2f", this->gamma_correct_);
+    if (this->dither_bits_ != 0) {
+      ESP_LOGCONFIG(TAG, "  Dither Bits: %u", this->dither_bits_);
+    }
   }
   if (this->get_traits().supports_color_capability(ColorCapability::COLOR_TEMPERATURE)) {
     ESP_LOGCONFIG(TAG, "  Min Mireds: %.1f", this->get_traits().get_min_mireds());
@@ -141,8 +144,20 @@ void LightState::loop() {
   // Write state to the light
   if (this->next_write_) {
     this->next_write_ = false;
+    this->dither_active_ = false;
     this->output_->write_state(this);
+    if (this->dither_active_) {
+      // Keep alternating between the output steps around the requested levels
+      this->next_write_ = true;
+      this->dither_high_freq_.start();
+    } else {
+      this->dither_high_freq_.stop();
+    }
   }
+
+  // Nothing left to do until the next call, effect or schedule_show()
+  if (effect == nullptr && this->transformer_ == nullptr && !this->next_write_)
+    this->disable_loop();
 }
 
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
@@ -187,33 +202,40 @@ void LightState::add_effects(const std::vector<LightEffect *> &effects) {
 void LightState::current_values_as_binary(bool *binary) { this->current_values.as_binary(binary); }
 void LightState::current_values_as_brightness(float *brightness) {
   this->current_values.as_brightness(brightness, this->gamma_correct_);
+  this->dither_({brightness});
 }
 void LightState::current_values_as_rgb(float *red, float *green, float *blue, bool color_interlock) {
   auto traits = this->get_traits();
   this->current_values.as_rgb(red, green, blue, this->gamma_correct_, false);
+  this->dither_({red, green, blue});
 }
 void LightState::current_values_as_rgbw(float *red, float *green, float *blue, float *white, bool color_interlock) {
   auto traits = this->get_traits();
   this->current_values.as_rgbw(red, green, blue, white, this->gamma_correct_, false);
+  this->dither_({red, green, blue, white});
 }
 void LightState::current_values_as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white,
                                          bool constant_brightness) {
   this->current_values.as_rgbww(red, green, blue, cold_white, warm_white, this->gamma_correct_, constant_brightness);
+  this->dither_({red, green, blue, cold_white, warm_white});
 }
 void LightState::current_values_as_rgbct(float *red, float *green, float *blue, float *color_temperature,
                                          float *white_brightness) {
   auto traits = this->get_traits();
   this->current_values.as_rgbct(traits.get_min_mireds(), traits.get_max_mireds(), red, green, blue, color_temperature,
                                 white_brightness, this->gamma_correct_);
+  this->dither_({red, green, blue, white_brightness});
 }
 void LightState::current_values_as_cwww(float *cold_white, float *warm_white, bool constant_brightness) {
   auto traits = this->get_traits();
   this->current_values.as_cwww(cold_white, warm_white, this->gamma_correct_, constant_brightness);
+  this->dither_({cold_white, warm_white});
 }
 void LightState::current_values_as_ct(float *color_temperature, float *white_brightness) {
   auto traits = this->get_traits();
   this->current_values.as_ct(traits.get_min_mireds(), traits.get_max_mireds(), color_temperature, white_brightness,
                              this->gamma_correct_);
+  this->dither_({white_brightness});
 }
 
 bool LightState::is_transformer_active() { return this->is_transformer_active_; }
@@ -226,6 +248,7 @@ void LightState::start_effect_(uint32_t effect_index) {
   this->active_effect_index_ = effect_index;
   auto *effect = this->get_active_effect_();
   effect->start_internal();
+  this->enable_loop();
 }
 LightEffect *LightState::get_active_effect_() {
   if (this->active_effect_index_ == 0) {
@@ -245,6 +268,7 @@ void LightState::stop_effect_() {
 void LightState::start_transition_(const LightColorValues &target, uint32_t length, bool set_remote_values) {
   this->transformer_ = this->output_->create_default_transition();
   this->transformer_->setup(this->current_values, target, length);
+  this->enable_loop();
 
   if (set_remote_values) {
     this->remote_values = target;
@@ -260,6 +284,7 @@ void LightState::start_flash_(const LightColorValues &target, uint32_t length, b
 
   this->transformer_ = make_unique<LightFlashTransformer>(*this);
   this->transformer_->setup(end_colors, target, length);
+  this->enable_loop();
 
   if (set_remote_values) {
     this->remote_values = target;
@@ -275,6 +300,28 @@ void LightState::set_immediately_(const LightColorValues &target, bool set_remot
   }
   this->output_->update_state(this);
   this->next_write_ = true;
+  this->enable_loop();
+}
+
+void LightState::dither_(std::initializer_list<float *> values) {
+  if (this->dither_bits_ == 0)
+    return;
+  const float max_level = (1 << this->dither_bits_) - 1;
+  float *error = this->dither_error_;
+  for (float *value : values) {
+    if (*value <= 0.0f || *value >= 1.0f) {
+      // Keep off and full on exact
+      *error++ = 0.0f;
+      continue;
+    }
+    const float target = *value * max_level;
+    if (fabsf(target - roundf(target)) > 0.001f)
+      this->dither_active_ = true;
+    const float wanted = target + *error;
+    const float level = clamp(roundf(wanted), 0.0f, max_level);
+    *error++ = wanted - level;
+    *value = level / max_level;
+  }
 }
 
 void LightState::save_remote_values_() {
@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/entity_base.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/optional.h"
 #include "esphome/core/preferences.h"
 #include "light_call.h"
@@ -10,6 +11,7 @@
 #include "light_traits.h"
 #include "light_transformer.h"
 
+#include <initializer_list>
 #include <vector>
 
 namespace esphome {
@@ -113,6 +115,13 @@ class LightState : public EntityBase, public Component {
   void set_gamma_correct(float gamma_correct);
   float get_gamma_correct() const { return this->gamma_correct_; }
 
+  /** Set the resolution in bits of the outputs of this light to enable temporal dithering.
+   *
+   * Output levels between two steps of the output are then approximated by alternating between the
+   * neighbouring steps on every loop. 0 (the default) disables dithering.
+   */
+  void set_dither_bits(uint8_t dither_bits) { this->dither_bits_ = dither_bits; }
+
   /// Set the restore mode of this light
   void set_restore_mode(LightRestoreMode restore_mode);
 
@@ -178,6 +187,9 @@ class LightState : public EntityBase, public Component {
   /// Internal method to save the current remote_values to the preferences
   void save_remote_values_();
 
+  /// Quantize gamma corrected output levels to dither_bits_, carrying the error over to the next write.
+  void dither_(std::initializer_list<float *> values);
+
   /// Store the output to allow effects to have more access.
   LightOutput *output_;
   /// Value for storing the index of the currently active effect. 0 if no effect is active
@@ -210,6 +222,13 @@ class LightState : public EntityBase, public Component {
   uint32_t flash_transition_length_{};
   /// Gamma correction factor for the light.
   float gamma_correct_{};
+  /// Output resolution for temporal dithering, 0 if disabled.
+  uint8_t dither_bits_{0};
+  /// Whether the last write had output levels between two output steps.
+  bool dither_active_{false};
+  /// Quantization error per output channel carried over to the next write.
+  float dither_error_[5]{};
+  HighFrequencyLoopRequester dither_high_freq_;
   /// Restore mode of the light.
   LightRestoreMode restore_mode_;
   /// List of effects for this light.
@@ -0,0 +1,124 @@
+from urllib.parse import parse_qs, urlparse
+
+import esphome.codegen as cg
+from esphome.components import sensor, time
+from esphome.components.http_request import (
+    CONF_HTTP_REQUEST_ID,
+    HttpRequestComponent,
+    validate_url,
+)
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_BUFFER_SIZE,
+    CONF_FORMAT,
+    CONF_ID,
+    CONF_NAME,
+    CONF_SENSORS,
+    CONF_TIME_ID,
+    CONF_URL,
+)
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["http_request", "time"]
+MULTI_CONF = True
+
+CONF_MAX_BATCH_SIZE = "max_batch_size"
+CONF_TOKEN = "token"
+
+line_protocol_ns = cg.esphome_ns.namespace("line_protocol")
+LineProtocolComponent = line_protocol_ns.class_(
+    "LineProtocolComponent", cg.PollingComponent
+)
+LineProtocolFormat = line_protocol_ns.enum("LineProtocolFormat")
+
+FORMAT_INFLUXDB = "influxdb"
+FORMAT_GRAPHITE = "graphite"
+FORMATS = {
+    FORMAT_INFLUXDB: LineProtocolFormat.LINE_PROTOCOL_FORMAT_INFLUXDB,
+    FORMAT_GRAPHITE: LineProtocolFormat.LINE_PROTOCOL_FORMAT_GRAPHITE,
+}
+
+
+def _validate_metric_name(value):
+    value = cv.string_strict(value)
+    if any(c in value for c in " ,=\n"):
+        raise cv.Invalid("Metric names must not contain spaces, commas or '='")
+    return value
+
+
+def _validate_batch_size(config):
+    if config[CONF_MAX_BATCH_SIZE] > config[CONF_BUFFER_SIZE]:
+        raise cv.Invalid(
+            f"'{CONF_MAX_BATCH_SIZE}' must not be larger than '{CONF_BUFFER_SIZE}'"
+        )
+    return config
+
+
+def _validate_precision(config):
+    # Timestamps are sent in seconds, so the URL can't ask InfluxDB for another unit
+    if config[CONF_FORMAT] == FORMAT_INFLUXDB:
+        query = parse_qs(urlparse(config[CONF_URL]).query)
+        if query.get("precision", ["s"]) != ["s"]:
+            raise cv.Invalid(
+                "Timestamps are sent in seconds, 'precision' must be 's' if set",
+                path=[CONF_URL],
+            )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(LineProtocolComponent),
+            cv.GenerateID(CONF_HTTP_REQUEST_ID): cv.use_id(HttpRequestComponent),
+            cv.GenerateID(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
+            cv.Required(CONF_URL): validate_url,
+            cv.Optional(CONF_FORMAT, default=FORMAT_INFLUXDB): cv.enum(
+                FORMATS, lower=True
+            ),
+            cv.Optional(CONF_TOKEN): cv.string_strict,
+            cv.Optional(CONF_BUFFER_SIZE, default="4kB"): cv.All(
+                cv.validate_bytes, cv.int_range(min=256)
+            ),
+            cv.Optional(CONF_MAX_BATCH_SIZE, default="1kB"): cv.All(
+                cv.validate_bytes, cv.int_range(min=256)
+            ),
+            cv.Required(CONF_SENSORS): cv.ensure_list(
+                cv.Schema(
+                    {
+                        cv.Required(CONF_ID): cv.use_id(sensor.Sensor),
+                        cv.Required(CONF_NAME): _validate_metric_name,
+                    }
+                )
+            ),
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    _validate_batch_size,
+    _validate_precision,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await cg.register_parented(var, config[CONF_HTTP_REQUEST_ID])
+
+    time_ = await cg.get_variable(config[CONF_TIME_ID])
+    cg.add(var.set_time(time_))
+
+    url = config[CONF_URL]
+    if config[CONF_FORMAT] == FORMAT_INFLUXDB and "precision" not in parse_qs(
+        urlparse(url).query
+    ):
+        # Timestamps are sent in seconds, InfluxDB defaults to nanoseconds
+        url += ("&" if "?" in url else "?") + "precision=s"
+    cg.add(var.set_url(url))
+    cg.add(var.set_format(config[CONF_FORMAT]))
+    if CONF_TOKEN in config:
+        cg.add(var.set_token(config[CONF_TOKEN]))
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    cg.add(var.set_max_batch_size(config[CONF_MAX_BATCH_SIZE]))
+
+    for sensor_config in config[CONF_SENSORS]:
+        sens = await cg.get_variable(sensor_config[CONF_ID])
+        cg.add(var.add_sensor(sens, sensor_config[CONF_NAME]))
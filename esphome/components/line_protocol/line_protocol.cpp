@@ -0,0 +1,142 @@
+#include "line_protocol.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace line_protocol {
+
+static const char *const TAG = "line_protocol";
+
+static const uint32_t MIN_RETRY_DELAY = 5000;
+static const uint32_t MAX_RETRY_DELAY = 300000;
+
+void LineProtocolComponent::setup() {
+  this->ring_.resize(this->buffer_size_);
+  this->batch_.reserve(this->max_batch_size_);
+  this->device_ = App.get_name();
+  // Nothing to send until the first samples are taken
+  this->disable_loop();
+}
+
+void LineProtocolComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Line Protocol:");
+  ESP_LOGCONFIG(TAG, "  Format: %s", this->format_ == LINE_PROTOCOL_FORMAT_INFLUXDB ? "InfluxDB" : "Graphite");
+  ESP_LOGCONFIG(TAG, "  URL: %s", this->url_);
+  ESP_LOGCONFIG(TAG, "  Buffer Size: %u", this->buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Max Batch Size: %u", this->max_batch_size_);
+  LOG_UPDATE_INTERVAL(this);
+  for (auto &s : this->sensors_)
+    ESP_LOGCONFIG(TAG, "  Sensor: %s", s.name);
+}
+
+void LineProtocolComponent::update() {
+  ESPTime now = this->time_->utcnow();
+  if (!now.is_valid()) {
+    ESP_LOGD(TAG, "Time is not synchronized yet, skipping samples");
+    return;
+  }
+
+  uint32_t dropped = this->dropped_;
+  char line[256];
+  for (auto &s : this->sensors_) {
+    if (!s.sensor->has_state() || std::isnan(s.sensor->state))
+      continue;
+    int8_t decimals = std::max<int8_t>(s.sensor->get_accuracy_decimals(), 0);
+    int len;
+    if (this->format_ == LINE_PROTOCOL_FORMAT_INFLUXDB) {
+      len = snprintf(line, sizeof(line), "%s,device=%s value=%.*f %" PRId64 "\n", s.name, this->device_.c_str(),
+                     decimals, s.sensor->state, (int64_t) now.timestamp);
+    } else {
+      len = snprintf(line, sizeof(line), "%s %.*f %" PRId64 "\n", s.name, decimals, s.sensor->state,
+                     (int64_t) now.timestamp);
+    }
+    if (len < 0 || static_cast<size_t>(len) >= sizeof(line)) {
+      ESP_LOGW(TAG, "Line for %s is too long", s.name);
+      continue;
+    }
+    this->append_(line, len);
+  }
+  if (this->dropped_ != dropped)
+    ESP_LOGW(TAG, "Buffer full, dropped %" PRIu32 " old lines", this->dropped_ - dropped);
+
+  if (this->ring_used_ > 0)
+    this->enable_loop();
+}
+
+void LineProtocolComponent::loop() {
+  if (this->ring_used_ == 0) {
+    this->disable_loop();
+    return;
+  }
+  if (this->retry_delay_ != 0 && millis() - this->last_failure_ < this->retry_delay_)
+    return;
+
+  // One batch per loop iteration, so a large backlog doesn't block other components
+  if (this->send_batch_()) {
+    this->retry_delay_ = 0;
+    this->status_clear_warning();
+  } else {
+    this->retry_delay_ = std::min(std::max(this->retry_delay_ * 2, MIN_RETRY_DELAY), MAX_RETRY_DELAY);
+    this->last_failure_ = millis();
+    this->status_set_warning();
+    ESP_LOGW(TAG, "Sending failed, %u bytes pending, retrying in %" PRIu32 "s", this->ring_used_,
+             this->retry_delay_ / 1000);
+  }
+}
+
+void LineProtocolComponent::append_(const char *line, size_t len) {
+  size_t capacity = this->ring_.size();
+  if (len > capacity)
+    return;
+  while (capacity - this->ring_used_ < len) {
+    // Drop the oldest line
+    size_t drop = 0;
+    while (drop < this->ring_used_ && this->ring_[(this->ring_head_ + drop) % capacity] != '\n')
+      drop++;
+    drop = std::min(drop + 1, this->ring_used_);
+    this->ring_head_ = (this->ring_head_ + drop) % capacity;
+    this->ring_used_ -= drop;
+    this->dropped_++;
+  }
+  size_t tail = (this->ring_head_ + this->ring_used_) % capacity;
+  size_t first = std::min(len, capacity - tail);
+  memcpy(&this->ring_[tail], line, first);
+  memcpy(&this->ring_[0], line + first, len - first);
+  this->ring_used_ += len;
+}
+
+bool LineProtocolComponent::send_batch_() {
+  size_t capacity = this->ring_.size();
+  size_t len = std::min(this->ring_used_, this->max_batch_size_);
+  // Only send complete lines, a single line longer than the batch size is sent by itself
+  while (len > 0 && this->ring_[(this->ring_head_ + len - 1) % capacity] != '\n')
+    len--;
+  while (len == 0 || (len < this->ring_used_ && this->ring_[(this->ring_head_ + len - 1) % capacity] != '\n'))
+    len++;
+
+  this->batch_.clear();
+  size_t first = std::min(len, capacity - this->ring_head_);
+  this->batch_.append(&this->ring_[this->ring_head_], first);
+  this->batch_.append(&this->ring_[0], len - first);
+
+  std::list<http_request::Header> headers;
+  headers.push_back({"Content-Type", "text/plain; charset=utf-8"});
+  if (!this->authorization_.empty())
+    headers.push_back({"Authorization", this->authorization_.c_str()});
+  auto container = this->parent_->post(this->url_, this->batch_, headers);
+  if (container == nullptr)
+    return false;
+  container->end();
+
+  ESP_LOGV(TAG, "Sent %u bytes", len);
+  this->ring_head_ = (this->ring_head_ + len) % capacity;
+  this->ring_used_ -= len;
+  return true;
+}
+
+}  // namespace line_protocol
+}  // namespace esphome
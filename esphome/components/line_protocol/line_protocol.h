@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "esphome/components/http_request/http_request.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/time/real_time_clock.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace line_protocol {
+
+enum LineProtocolFormat : uint8_t {
+  LINE_PROTOCOL_FORMAT_INFLUXDB,
+  LINE_PROTOCOL_FORMAT_GRAPHITE,
+};
+
+struct LineProtocolSensor {
+  sensor::Sensor *sensor;
+  const char *name;
+};
+
+/** Pushes timestamped sensor samples to a time series database over HTTP.
+ *
+ * Samples are rendered as InfluxDB line protocol or Graphite plaintext into a fixed size ring buffer and sent in
+ * batches. When the server can't be reached, unsent lines stay in the ring and are retried with an increasing
+ * delay; once the ring is full, the oldest lines are dropped.
+ */
+class LineProtocolComponent : public PollingComponent, public Parented<http_request::HttpRequestComponent> {
+ public:
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  void set_format(LineProtocolFormat format) { this->format_ = format; }
+  void set_time(time::RealTimeClock *time) { this->time_ = time; }
+  void set_url(const char *url) { this->url_ = url; }
+  /// Set the InfluxDB API token sent in the Authorization header.
+  void set_token(const std::string &token) { this->authorization_ = "Token " + token; }
+  void set_buffer_size(size_t buffer_size) { this->buffer_size_ = buffer_size; }
+  void set_max_batch_size(size_t max_batch_size) { this->max_batch_size_ = max_batch_size; }
+  void add_sensor(sensor::Sensor *sensor, const char *name) { this->sensors_.push_back({sensor, name}); }
+
+ protected:
+  /// Add a line to the ring, dropping the oldest lines if there isn't enough space.
+  void append_(const char *line, size_t len);
+  /// Send the oldest lines, up to max_batch_size_ bytes, and remove them from the ring if that succeeded.
+  bool send_batch_();
+
+  LineProtocolFormat format_{LINE_PROTOCOL_FORMAT_INFLUXDB};
+  time::RealTimeClock *time_{nullptr};
+  const char *url_{nullptr};
+  std::string authorization_;
+  std::string device_;
+  std::vector<LineProtocolSensor> sensors_;
+
+  size_t buffer_size_{4096};
+  size_t max_batch_size_{1024};
+  std::vector<char, ExternalRAMAllocator<char>> ring_;
+  size_t ring_head_{0};  ///< Offset of the oldest line.
+  size_t ring_used_{0};
+  std::string batch_;
+  uint32_t dropped_{0};
+
+  uint32_t last_failure_{0};
+  uint32_t retry_delay_{0};
+};
+
+}  // namespace line_protocol
+}  // namespace esphome
@@ -3,6 +3,7 @@ import logging
 from esphome.automation import build_automation, register_action, validate_automation
 import esphome.codegen as cg
 from esphome.components.display import Display
+from esphome.components.image import CONF_COMPRESSION
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_AUTO_CLEAR_ENABLED,
@@ -164,6 +165,8 @@ def final_validation(config):
                 "Using auto_clear_enabled: true in display config not compatible with LVGL"
             )
     buffer_frac = config[CONF_BUFFER_SIZE]
+    if config[df.CONF_DOUBLE_BUFFER]:
+        buffer_frac *= 2
     if CORE.is_esp32 and buffer_frac > 0.5 and "psram" not in global_config:
         LOGGER.warning("buffer_size: may need to be reduced without PSRAM")
     for image_id in lv_images_used:
@@ -173,6 +176,10 @@ def final_validation(config):
             raise cv.Invalid(
                 "Using RGBA or RGB24 in image config not compatible with LVGL", path
             )
+        if image_conf.get(CONF_COMPRESSION, "NONE") != "NONE":
+            raise cv.Invalid(
+                "Using compression in image config not compatible with LVGL", path
+            )
     for w in focused_widgets:
         path = global_config.get_path_for_id(w)
         widget_conf = global_config.get_config_for_path(path[:-1])
@@ -233,6 +240,8 @@ async def to_code(config):
         frac = 8
     cg.add(lv_component.set_buffer_frac(int(frac)))
     cg.add(lv_component.set_full_refresh(config[df.CONF_FULL_REFRESH]))
+    if config[df.CONF_DOUBLE_BUFFER]:
+        cg.add(lv_component.set_double_buffer(True))
 
     for font in helpers.esphome_fonts_used:
         await cg.get_variable(font)
@@ -313,6 +322,7 @@ CONFIG_SCHEMA = (
             cv.Optional(df.CONF_DEFAULT_FONT, default="montserrat_14"): lvalid.lv_font,
             cv.Optional(df.CONF_FULL_REFRESH, default=False): cv.boolean,
             cv.Optional(CONF_BUFFER_SIZE, default="100%"): cv.percentage,
+            cv.Optional(df.CONF_DOUBLE_BUFFER, default=False): cv.boolean,
             cv.Optional(df.CONF_LOG_LEVEL, default="WARN"): cv.one_of(
                 *df.LOG_LEVELS, upper=True
             ),
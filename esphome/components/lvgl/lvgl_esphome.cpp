@@ -143,12 +143,34 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, const uint8_t *ptr) {
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
     auto now = millis();
-    this->draw_buffer_(area, (const uint8_t *) color_p);
+    if (this->draw_buf_.buf2 != nullptr && this->displays_.size() == 1) {
+      // the display may send the pixels in the background while LVGL renders into the other buffer
+      this->flush_pending_ = this->displays_[0]->draw_pixels_at_async(
+          area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area), (const uint8_t *) color_p,
+          display::COLOR_ORDER_RGB, LV_BITNESS, LV_COLOR_16_SWAP);
+    } else {
+      this->draw_buffer_(area, (const uint8_t *) color_p);
+    }
+    auto elapsed = millis() - now;
+    this->frame_stats_.flush_time += elapsed;
     ESP_LOGV(TAG, "flush_cb, area=%d/%d, %d/%d took %dms", area->x1, area->y1, lv_area_get_width(area),
-             lv_area_get_height(area), (int) (millis() - now));
+             lv_area_get_height(area), (int) elapsed);
+    if (this->flush_pending_)
+      return;
   }
   lv_disp_flush_ready(disp_drv);
 }
+
+void LvglComponent::finish_flush_() {
+  if (!this->flush_pending_)
+    return;
+  auto now = millis();
+  this->displays_[0]->wait_draw_complete();
+  this->flush_pending_ = false;
+  this->frame_stats_.flush_time += millis() - now;
+  lv_disp_flush_ready(&this->disp_drv_);
+}
+
 IdleTrigger::IdleTrigger(LvglComponent *parent, TemplatableValue<uint32_t> timeout) : timeout_(std::move(timeout)) {
   parent->add_on_idle_callback([this](uint32_t idle_time) {
     if (!this->is_idle_ && idle_time > this->timeout_.value()) {
@@ -182,6 +204,18 @@ void LVTouchListener::update(const touchscreen::TouchPoints_t &tpoints) {
   this->touch_pressed_ = !this->parent_->is_paused() && !tpoints.empty();
   if (this->touch_pressed_)
     this->touch_point_ = tpoints[0];
+  this->read_now_();
+}
+
+void LVTouchListener::release() {
+  this->touch_pressed_ = false;
+  this->read_now_();
+}
+
+void LVTouchListener::read_now_() {
+  // Have LVGL read the touch on its next run, instead of when its read period comes around
+  if (this->drv_.read_timer != nullptr)
+    lv_timer_ready(this->drv_.read_timer);
 }
 #endif  // USE_LVGL_TOUCHSCREEN
 
@@ -300,12 +334,20 @@ void LvglComponent::setup() {
     this->status_set_error("Memory allocation failure");
     return;
   }
-  lv_disp_draw_buf_init(&this->draw_buf_, buf, nullptr, buffer_pixels);
+  void *buf2 = nullptr;
+  if (this->double_buffer_) {
+    buf2 = lv_custom_mem_alloc(buf_bytes);
+    if (buf2 == nullptr)
+      ESP_LOGW(TAG, "Malloc failed to allocate %zu bytes for the second buffer, using a single buffer", buf_bytes);
+  }
+  lv_disp_draw_buf_init(&this->draw_buf_, buf, buf2, buffer_pixels);
   lv_disp_drv_init(&this->disp_drv_);
   this->disp_drv_.draw_buf = &this->draw_buf_;
   this->disp_drv_.user_data = this;
   this->disp_drv_.full_refresh = this->full_refresh_;
   this->disp_drv_.flush_cb = static_flush_cb;
+  this->disp_drv_.wait_cb = static_wait_cb;
+  this->disp_drv_.monitor_cb = static_monitor_cb;
   this->disp_drv_.rounder_cb = rounder_cb;
   switch (display->get_rotation()) {
     case display::DISPLAY_ROTATION_0_DEGREES:
@@ -335,6 +377,14 @@ void LvglComponent::setup() {
   ESP_LOGCONFIG(TAG, "LVGL Setup complete");
 }
 void LvglComponent::update() {
+  this->last_frame_stats_ = this->frame_stats_;
+  this->frame_stats_ = {};
+  const auto &stats = this->last_frame_stats_;
+  if (stats.frames != 0) {
+    ESP_LOGV(TAG, "%u frames, %u px, frame time avg %ums max %ums, flush time avg %ums", (unsigned) stats.frames,
+             (unsigned) stats.pixels, (unsigned) (stats.frame_time / stats.frames), (unsigned) stats.max_frame_time,
+             (unsigned) (stats.flush_time / stats.frames));
+  }
   // update indicators
   if (this->paused_) {
     return;
@@ -347,6 +397,8 @@ void LvglComponent::loop() {
       this->write_random_();
   }
   lv_timer_handler_run_in_period(5);
+  // don't hold on to the display beyond this component's loop
+  this->finish_flush_();
 }
 bool lv_is_pre_initialise() {
   if (!lv_is_initialized()) {
@@ -411,6 +463,16 @@ void lv_animimg_stop(lv_obj_t *obj) {
 void LvglComponent::static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   reinterpret_cast<LvglComponent *>(disp_drv->user_data)->flush_cb_(disp_drv, area, color_p);
 }
+void LvglComponent::static_wait_cb(lv_disp_drv_t *disp_drv) {
+  reinterpret_cast<LvglComponent *>(disp_drv->user_data)->finish_flush_();
+}
+void LvglComponent::static_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+  auto &stats = reinterpret_cast<LvglComponent *>(disp_drv->user_data)->frame_stats_;
+  stats.frames++;
+  stats.pixels += px;
+  stats.frame_time += time;
+  stats.max_frame_time = std::max(stats.max_frame_time, time);
+}
 }  // namespace lvgl
 }  // namespace esphome
 
@@ -110,11 +110,22 @@ lv_img_dsc_t *lv_img_from(image::Image *src, lv_img_dsc_t *img_dsc = nullptr);
 void lv_animimg_stop(lv_obj_t *obj);
 #endif  // USE_LVGL_ANIMIMG
 
+/// Rendering statistics, collected over one update interval.
+struct LvFrameStats {
+  uint32_t frames;          ///< Number of display refreshes.
+  uint32_t pixels;          ///< Number of pixels refreshed.
+  uint32_t frame_time;      ///< Total time spent refreshing, in ms.
+  uint32_t max_frame_time;  ///< Longest single refresh, in ms.
+  uint32_t flush_time;      ///< Time spent sending pixels to the displays or waiting for them, in ms.
+};
+
 class LvglComponent : public PollingComponent {
   constexpr static const char *const TAG = "lvgl";
 
  public:
   static void static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  static void static_wait_cb(lv_disp_drv_t *disp_drv);
+  static void static_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
 
   float get_setup_priority() const override { return setup_priority::PROCESSOR; }
   void setup() override;
@@ -129,6 +140,9 @@ class LvglComponent : public PollingComponent {
   void set_full_refresh(bool full_refresh) { this->full_refresh_ = full_refresh; }
   bool is_idle(uint32_t idle_ms) { return lv_disp_get_inactive_time(this->disp_) > idle_ms; }
   void set_buffer_frac(size_t frac) { this->buffer_frac_ = frac; }
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
+  /// Statistics of the last complete update interval.
+  const LvFrameStats &get_frame_stats() const { return this->last_frame_stats_; }
   lv_disp_t *get_disp() { return this->disp_; }
   void set_paused(bool paused, bool show_snow);
   void add_event_cb(lv_obj_t *obj, event_callback_t callback, lv_event_code_t event);
@@ -153,6 +167,8 @@ class LvglComponent : public PollingComponent {
   void write_random_();
   void draw_buffer_(const lv_area_t *area, const uint8_t *ptr);
   void flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  /// Wait for a flush still in progress in the background and hand its buffer back to LVGL.
+  void finish_flush_();
   std::vector<display::Display *> displays_{};
   lv_disp_draw_buf_t draw_buf_{};
   lv_disp_drv_t disp_drv_{};
@@ -169,6 +185,10 @@ class LvglComponent : public PollingComponent {
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   size_t buffer_frac_{1};
   bool full_refresh_{};
+  bool double_buffer_{};
+  bool flush_pending_{};
+  LvFrameStats frame_stats_{};
+  LvFrameStats last_frame_stats_{};
 };
 
 class IdleTrigger : public Trigger<> {
@@ -204,10 +224,12 @@ class LVTouchListener : public touchscreen::TouchListener, public Parented<LvglC
  public:
   LVTouchListener(uint16_t long_press_time, uint16_t long_press_repeat_time);
   void update(const touchscreen::TouchPoints_t &tpoints) override;
-  void release() override { touch_pressed_ = false; }
+  void release() override;
   lv_indev_drv_t *get_drv() { return &this->drv_; }
 
  protected:
+  void read_now_();
+
   lv_indev_drv_t drv_{};
   touchscreen::TouchPoint touch_point_{};
   bool touch_pressed_{};
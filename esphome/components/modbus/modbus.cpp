@@ -24,14 +24,17 @@ void Modbus::loop() {
     waiting_for_response = 0;
   }
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
-    } else {
-      this->rx_buffer_.clear();
+  const uint8_t *data;
+  size_t len;
+  while ((len = this->peek_rx(&data)) > 0) {
+    for (size_t i = 0; i < len; i++) {
+      if (this->parse_modbus_byte_(data[i])) {
+        this->last_modbus_byte_ = now;
+      } else {
+        this->rx_buffer_.clear();
+      }
     }
+    this->consume_rx(len);
   }
 }
 
@@ -2,6 +2,7 @@
 #include "esphome/core/util.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <algorithm>
 #include <cinttypes>
 
 namespace esphome {
@@ -31,12 +32,16 @@ bool Nextion::send_command_(const std::string &command) {
     return false;
   }
 
+  this->write_command_(command);
+  return true;
+}
+
+void Nextion::write_command_(const std::string &command) {
   ESP_LOGN(TAG, "send_command %s", command.c_str());
 
   this->write_str(command.c_str());
   const uint8_t to_send[3] = {0xFF, 0xFF, 0xFF};
   this->write_array(to_send, sizeof(to_send));
-  return true;
 }
 
 bool Nextion::check_connect_() {
@@ -132,6 +137,8 @@ void Nextion::reset_(bool reset_nextion) {
   };
   this->nextion_queue_.clear();
   this->waveform_queue_.clear();
+  this->bytes_in_flight_ = 0;
+  this->unsent_commands_ = 0;
 }
 
 void Nextion::dump_config() {
@@ -212,11 +219,8 @@ bool Nextion::send_command(const char *command) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return false;
 
-  if (this->send_command_(command)) {
-    this->add_no_result_to_queue_("send_command");
-    return true;
-  }
-  return false;
+  this->add_no_result_to_queue_with_command_("send_command", command);
+  return true;
 }
 
 bool Nextion::send_command_printf(const char *format, ...) {
@@ -233,11 +237,8 @@ bool Nextion::send_command_printf(const char *format, ...) {
     return false;
   }
 
-  if (this->send_command_(buffer)) {
-    this->add_no_result_to_queue_("send_command_printf");
-    return true;
-  }
-  return false;
+  this->add_no_result_to_queue_with_command_("send_command_printf", buffer);
+  return true;
 }
 
 #ifdef NEXTION_PROTOCOL_LOG
@@ -324,11 +325,66 @@ bool Nextion::remove_from_q_(bool report_empty) {
     }
     delete component;  // NOLINT(cppcoreguidelines-owning-memory)
   }
-  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
   this->nextion_queue_.pop_front();
+  this->release_queue_entry_(nb, true);
   return true;
 }
 
+void Nextion::release_queue_entry_(NextionQueue *nb, bool answered) {
+  if (nb->sent_length == 0) {
+    this->unsent_commands_--;
+  } else {
+    this->bytes_in_flight_ -= nb->sent_length;
+    if (answered) {
+      this->last_command_latency_ = millis() - nb->queue_time;
+      this->max_command_latency_ = std::max(this->max_command_latency_, this->last_command_latency_);
+    }
+  }
+  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+void Nextion::send_queued_commands_() {
+  size_t index = this->nextion_queue_.size() - this->unsent_commands_;
+  while (this->unsent_commands_ > 0) {
+    NextionQueue *nb = this->nextion_queue_[index];
+    size_t length = nb->command.length() + COMMAND_DELIMITER.length();
+    // The display answers every command (bkcmd=3), so the unanswered ones are what may still be in its buffer
+    if (this->bytes_in_flight_ > 0 && this->bytes_in_flight_ + length > NEXTION_SERIAL_BUFFER_SIZE)
+      break;
+
+    this->write_command_(nb->command);
+    nb->command.clear();
+    nb->sent_length = length;
+    this->bytes_in_flight_ += length;
+    this->unsent_commands_--;
+    index++;
+  }
+}
+
+bool Nextion::merge_queued_command_(const std::string &variable_name, const std::string &command,
+                                    uint16_t merge_length) {
+  if (merge_length == 0)
+    return false;
+
+  // Look back through the waiting commands. Assignments to other attributes can be passed, anything else could
+  // depend on the value and keeps it from being replaced.
+  for (size_t i = this->nextion_queue_.size(); i > this->nextion_queue_.size() - this->unsent_commands_; i--) {
+    NextionQueue *nb = this->nextion_queue_[i - 1];
+    if (nb->merge_length == 0 || nb->component->get_queue_type() != NextionQueueType::NO_RESULT)
+      return false;
+    if (nb->merge_length == merge_length && nb->command.compare(0, merge_length, command, 0, merge_length) == 0) {
+      if (nb->component->get_variable_name() != variable_name)
+        return false;
+      ESP_LOGN(TAG, "Replacing queued command %s with %s", nb->command.c_str(), command.c_str());
+      nb->command = command;
+      nb->queue_time = millis();
+      this->merged_commands_++;
+      return true;
+    }
+  }
+  return false;
+}
+
 void Nextion::process_serial_() {
   uint8_t d;
 
@@ -535,8 +591,8 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_string(to_process, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
         this->nextion_queue_.pop_front();
+        this->release_queue_entry_(nb, true);
 
         break;
       }
@@ -581,8 +637,8 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
         this->nextion_queue_.pop_front();
+        this->release_queue_entry_(nb, true);
 
         break;
       }
@@ -753,8 +809,8 @@ void Nextion::process_nextion_commands_() {
 
         auto &nb = this->waveform_queue_.front();
         auto *component = nb->component;
-        size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
-                                                                        : 255;  // ADDT command can only send 255
+        // As many bytes as announced by the addt command
+        size_t buffer_to_send = std::min<size_t>(nb->sent_length, component->get_wave_buffer_size());
 
         this->write_array(component->get_wave_buffer().data(), static_cast<int>(buffer_to_send));
 
@@ -802,9 +858,9 @@ void Nextion::process_nextion_commands_() {
           delete component;  // NOLINT(cppcoreguidelines-owning-memory)
         }
 
-        delete this->nextion_queue_[i];  // NOLINT(cppcoreguidelines-owning-memory)
-
+        NextionQueue *nb = this->nextion_queue_[i];
         this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
+        this->release_queue_entry_(nb, false);
         i--;
 
       } else {
@@ -813,6 +869,9 @@ void Nextion::process_nextion_commands_() {
     }
   }
   ESP_LOGN(TAG, "Loop End");
+  // Answers (or dropped commands) may have made room for more
+  this->send_queued_commands_();
+
   // App.feed_wdt(); Remove before master merge
   this->process_serial_();
 }  // namespace nextion
@@ -966,8 +1025,10 @@ uint16_t Nextion::recv_ret_string_(std::string &response, uint32_t timeout, bool
  * @brief
  *
  * @param variable_name Name for the queue
+ * @param command The command to send
  */
-void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
+void Nextion::add_no_result_to_queue_(const std::string &variable_name, const std::string &command,
+                                      uint16_t merge_length) {
   // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
   nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
 
@@ -976,10 +1037,15 @@ void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
   nextion_queue->component->set_variable_name(variable_name);
 
   nextion_queue->queue_time = millis();
+  nextion_queue->command = command;
+  nextion_queue->merge_length = merge_length;
 
   this->nextion_queue_.push_back(nextion_queue);
+  this->unsent_commands_++;
 
   ESP_LOGN(TAG, "Add to queue type: NORESULT component %s", nextion_queue->component->get_variable_name().c_str());
+
+  this->send_queued_commands_();
 }
 
 /**
@@ -987,13 +1053,15 @@ void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
  *
  * @param variable_name Variable name for the queue
  * @param command
+ * @param merge_length Length of the attribute a setter assigns at the start of the command, 0 if it is never merged
  */
-void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command) {
+void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command,
+                                                   uint16_t merge_length) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || command.empty())
     return;
 
-  if (this->send_command_(command)) {
-    this->add_no_result_to_queue_(variable_name);
+  if (!this->merge_queued_command_(variable_name, command, merge_length)) {
+    this->add_no_result_to_queue_(variable_name, command, merge_length);
   }
 }
 
@@ -1066,8 +1134,8 @@ void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &varia
   if ((!this->is_setup() && !this->ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_ignore_sleep_printf_(variable_name, "%s=%" PRId32, variable_name_to_send.c_str(),
-                                                         state_value);
+  this->add_no_result_to_queue_with_command_(variable_name, variable_name_to_send + "=" + to_string(state_value),
+                                             variable_name_to_send.size() + 1);
 }
 
 /**
@@ -1094,8 +1162,8 @@ void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &varia
   if ((!this->is_setup() && !this->ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_printf_(variable_name, "%s=\"%s\"", variable_name_to_send.c_str(),
-                                            state_value.c_str());
+  this->add_no_result_to_queue_with_command_(variable_name, variable_name_to_send + "=\"" + state_value + "\"",
+                                             variable_name_to_send.size() + 1);
 }
 
 void Nextion::add_to_get_queue(NextionComponentBase *component) {
@@ -1107,15 +1175,14 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
 
   nextion_queue->component = component;
   nextion_queue->queue_time = millis();
+  nextion_queue->command = "get " + component->get_variable_name_to_send();
 
   ESP_LOGN(TAG, "Add to queue type: %s component %s", component->get_queue_type_string().c_str(),
            component->get_variable_name().c_str());
 
-  std::string command = "get " + component->get_variable_name_to_send();
-
-  if (this->send_command_(command)) {
-    this->nextion_queue_.push_back(nextion_queue);
-  }
+  this->nextion_queue_.push_back(nextion_queue);
+  this->unsent_commands_++;
+  this->send_queued_commands_();
 }
 
 /**
@@ -1130,6 +1197,13 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return;
 
+  // An addt that hasn't been sent yet sends all the data buffered for the component by then, so new points
+  // are batched into it instead of queueing another one. The one at the front has already been sent.
+  for (size_t i = 1; i < this->waveform_queue_.size(); i++) {
+    if (this->waveform_queue_[i]->component == component)
+      return;
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
   nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
 
@@ -1142,17 +1216,22 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
 }
 
 void Nextion::check_pending_waveform_() {
-  if (this->waveform_queue_.empty())
-    return;
-
-  auto *nb = this->waveform_queue_.front();
-  auto *component = nb->component;
-  size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
-                                                                  : 255;  // ADDT command can only send 255
-
-  std::string command = "addt " + to_string(component->get_component_id()) + "," +
-                        to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
-  if (!this->send_command_(command)) {
+  while (!this->waveform_queue_.empty()) {
+    auto *nb = this->waveform_queue_.front();
+    auto *component = nb->component;
+    size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
+                                                                    : 255;  // ADDT command can only send 255
+
+    // The points may already have been sent along with an earlier addt
+    if (buffer_to_send > 0) {
+      std::string command = "addt " + to_string(component->get_component_id()) + "," +
+                            to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
+      if (this->send_command_(command)) {
+        // Points added until the display is ready go with the next addt
+        nb->sent_length = buffer_to_send;
+        return;
+      }
+    }
     delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
     this->waveform_queue_.pop_front();
   }
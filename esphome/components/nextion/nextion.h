@@ -34,6 +34,8 @@ class NextionComponentBase;
 using nextion_writer_t = std::function<void(Nextion &)>;
 
 static const std::string COMMAND_DELIMITER{static_cast<char>(255), static_cast<char>(255), static_cast<char>(255)};
+/// Size of the serial buffer of the display, queued commands are only sent while the unanswered ones fit in it.
+static const size_t NEXTION_SERIAL_BUFFER_SIZE = 1024;
 
 class Nextion : public NextionBase, public PollingComponent, public uart::UARTDevice {
  public:
@@ -1191,6 +1193,38 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    */
   size_t queue_size() { return this->nextion_queue_.size(); }
 
+  /**
+   * @brief Retrieves the number of queued commands that haven't been sent to the Nextion yet.
+   *
+   * Commands are sent right away as long as the ones still awaiting a response fit in the serial buffer of the
+   * display. Otherwise they wait in the queue, where a newer assignment to the same attribute replaces the
+   * waiting one, so a display that can't keep up gets the latest values instead of falling behind.
+   *
+   * @return size_t The number of commands waiting to be sent. These are included in queue_size().
+   */
+  size_t pending_queue_size() { return this->unsent_commands_; }
+
+  /**
+   * @brief Retrieves the time it took the Nextion to answer the last command, including the time it was queued.
+   *
+   * @return uint32_t The latency in milliseconds.
+   */
+  uint32_t get_last_command_latency() { return this->last_command_latency_; }
+
+  /**
+   * @brief Retrieves the longest time it took the Nextion to answer a command, including the time it was queued.
+   *
+   * @return uint32_t The latency in milliseconds.
+   */
+  uint32_t get_max_command_latency() { return this->max_command_latency_; }
+
+  /**
+   * @brief Retrieves how many queued commands have been replaced by a newer assignment to the same attribute.
+   *
+   * @return uint32_t The number of commands that were merged instead of sent.
+   */
+  uint32_t get_merged_command_count() { return this->merged_commands_; }
+
   /**
    * @brief Check if the TFT update process is currently running.
    *
@@ -1218,6 +1252,19 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   void all_components_send_state_(bool force_update = false);
   uint64_t comok_sent_ = 0;
   bool remove_from_q_(bool report_empty = true);
+  /// Delete a queue entry that has been taken off nextion_queue_, answered tells whether the Nextion responded to it.
+  void release_queue_entry_(NextionQueue *nb, bool answered);
+  /// Write waiting commands while the unanswered ones fit in the serial buffer of the display.
+  void send_queued_commands_();
+  /// Replace a waiting setter assignment to the same attribute with command, false if there is none.
+  bool merge_queued_command_(const std::string &variable_name, const std::string &command, uint16_t merge_length);
+  /// Bytes of the commands that have been sent but not answered yet.
+  size_t bytes_in_flight_{0};
+  /// Commands at the end of nextion_queue_ that haven't been sent yet.
+  size_t unsent_commands_{0};
+  uint32_t last_command_latency_{0};
+  uint32_t max_command_latency_{0};
+  uint32_t merged_commands_{0};
 
   /**
    * @brief
@@ -1243,10 +1290,13 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    * @param command The command to write, for example "vis b0,0".
    */
   bool send_command_(const std::string &command);
-  void add_no_result_to_queue_(const std::string &variable_name);
+  void write_command_(const std::string &command);
+  void add_no_result_to_queue_(const std::string &variable_name, const std::string &command,
+                               uint16_t merge_length = 0);
   bool add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
-  void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command);
+  void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command,
+                                            uint16_t merge_length = 0);
 
   bool add_no_result_to_queue_with_printf_(const std::string &variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
@@ -1,4 +1,5 @@
 #pragma once
+#include <string>
 #include <utility>
 #include <vector>
 #include "esphome/core/defines.h"
@@ -25,6 +26,12 @@ class NextionQueue {
   virtual ~NextionQueue() = default;
   NextionComponentBase *component;
   uint32_t queue_time = 0;
+  /// Command waiting to be sent, empty once it has been written to the display.
+  std::string command;
+  /// Bytes written to the display for the command (for an addt, the bytes of data announced), 0 until then.
+  uint16_t sent_length = 0;
+  /// Length of the "attribute=" prefix when a setter queued the command and a newer value may replace it, else 0.
+  uint16_t merge_length = 0;
 };
 
 class NextionComponentBase {
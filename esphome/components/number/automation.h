@@ -84,6 +84,10 @@ template<typename... Ts> class NumberInRangeCondition : public Condition<Ts...>
       return this->min_ <= state && state <= this->max_;
     }
   }
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    this->parent_->add_on_state_callback([callback = std::move(callback)](float) { callback(); });
+    return true;
+  }
 
  protected:
   Number *parent_;
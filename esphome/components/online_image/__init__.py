@@ -35,9 +35,13 @@ online_image_ns = cg.esphome_ns.namespace("online_image")
 
 ImageFormat = online_image_ns.enum("ImageFormat")
 
+FORMAT_JPEG = "JPEG"
 FORMAT_PNG = "PNG"
 
-IMAGE_FORMAT = {FORMAT_PNG: ImageFormat.PNG}  # Add new supported formats here
+IMAGE_FORMAT = {
+    FORMAT_JPEG: ImageFormat.JPEG,
+    FORMAT_PNG: ImageFormat.PNG,
+}  # Add new supported formats here
 
 OnlineImage = online_image_ns.class_("OnlineImage", cg.PollingComponent, Image_)
 
@@ -132,6 +136,8 @@ async def online_image_action_to_code(config, action_id, template_arg, args):
 
 async def to_code(config):
     format = config[CONF_FORMAT]
+    if format in [FORMAT_JPEG]:
+        cg.add_define("USE_ONLINE_IMAGE_JPEG_SUPPORT")
     if format in [FORMAT_PNG]:
         cg.add_define("USE_ONLINE_IMAGE_PNG_SUPPORT")
         cg.add_library("pngle", "1.0.2")
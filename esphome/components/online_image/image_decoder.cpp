@@ -24,6 +24,27 @@ void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
   }
 }
 
+void ImageDecoder::draw_rgb_row(int x, int y, int w, const uint8_t *rgb) {
+  if (this->x_scale_ == 1.0 && this->y_scale_ == 1.0) {
+    for (int i = 0; i < w; i++, rgb += 3)
+      this->image_->draw_pixel_(x + i, y, Color(rgb[0], rgb[1], rgb[2], 255));
+  } else {
+    for (int i = 0; i < w; i++, rgb += 3)
+      this->draw(x + i, y, 1, 1, Color(rgb[0], rgb[1], rgb[2], 255));
+  }
+}
+
+int ImageDecoder::get_scale_down(int width, int height, int max_scale) const {
+  if (this->image_->auto_resize_())
+    return 1;
+  int scale = 1;
+  while (scale < max_scale && (width + scale * 2 - 1) / (scale * 2) >= this->image_->fixed_width_ &&
+         (height + scale * 2 - 1) / (scale * 2) >= this->image_->fixed_height_) {
+    scale *= 2;
+  }
+  return scale;
+}
+
 uint8_t *DownloadBuffer::data(size_t offset) {
   if (offset > this->size_) {
     ESP_LOGE(TAG, "Tried to access beyond download buffer bounds!!!");
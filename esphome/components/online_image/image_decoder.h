@@ -63,6 +63,28 @@ class ImageDecoder {
    */
   void draw(int x, int y, int w, int h, const Color &color);
 
+  /**
+   * @brief Draw a row of opaque pixels, given as 3 bytes of RGB each.
+   * The pixels are written straight into the image buffer if the image doesn't need to be resized any further,
+   * otherwise they are scaled like in draw().
+   *
+   * @param x The left-most coordinate of the row.
+   * @param y The coordinate of the row.
+   * @param w The number of pixels in the row.
+   * @param rgb The colors of the pixels.
+   */
+  void draw_rgb_row(int x, int y, int w, const uint8_t *rgb);
+
+  /**
+   * @brief Get the largest power of two, up to max_scale, that the image can be scaled down by while decoding
+   * without ending up smaller than the requested size. This is 1 if the image keeps its original size.
+   *
+   * @param width The image's width.
+   * @param height The image's height.
+   * @param max_scale The largest factor the decoder can scale the image down by.
+   */
+  int get_scale_down(int width, int height, int max_scale) const;
+
   bool is_finished() const { return this->decoded_bytes_ == this->download_size_; }
 
  protected:
@@ -0,0 +1,647 @@
+#include "jpeg_image.h"
+#ifdef USE_ONLINE_IMAGE_JPEG_SUPPORT
+
+#include <algorithm>
+#include <cstring>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+static const char *const TAG = "online_image.jpeg";
+
+namespace esphome {
+namespace online_image {
+
+static const uint8_t JPEG_SOF0 = 0xC0;
+static const uint8_t JPEG_SOF1 = 0xC1;
+static const uint8_t JPEG_DHT = 0xC4;
+static const uint8_t JPEG_RST0 = 0xD0;
+static const uint8_t JPEG_RST7 = 0xD7;
+static const uint8_t JPEG_SOI = 0xD8;
+static const uint8_t JPEG_EOI = 0xD9;
+static const uint8_t JPEG_SOS = 0xDA;
+static const uint8_t JPEG_DQT = 0xDB;
+static const uint8_t JPEG_DRI = 0xDD;
+
+/// Natural order index of each coefficient, in the zigzag order they are stored in.
+static const uint8_t ZIGZAG[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48,
+    41, 34, 27, 20, 13, 6,  7,  14, 21, 28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23,
+    30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/**
+ * IDCT kernels for an output of 1, 2, 4 and 8 samples, with 11 fractional bits. Entry [x * 8 + u] is the weight of
+ * coefficient u in output sample x: C(u) / 2 * cos((2i + 1) * u * pi / 16), averaged over the 8 / n samples i that
+ * make up x. Scaling down this way gives the same result as averaging the full size output, at a fraction of the
+ * cost.
+ */
+static const int16_t IDCT_KERNEL_1[8] = {724, 0, 0, 0, 0, 0, 0, 0};
+static const int16_t IDCT_KERNEL_2[16] = {724, 656, 0, -230, 0, 154, 0, -131, 724, -656, 0, 230, 0, -154, 0, 131};
+static const int16_t IDCT_KERNEL_4[32] = {
+    724, 928,  669,  326,  0, -218, -277, -185, 724, 384,  -669, -787, 0, 526,  277,  -76,
+    724, -384, -669, 787,  0, -526, 277,  76,   724, -928, 669,  -326, 0, 218,  -277, 185,
+};
+static const int16_t IDCT_KERNEL_8[64] = {
+    724, 1004, 946,  851,  724,  569,  392,  200,  724, 851,  392,  -200, -724, -1004, -946, -569,
+    724, 569,  -392, -1004, -724, 200,  946,  851,  724, 200,  -946, -569, 724,  851,   -392, -1004,
+    724, -200, -946, 569,  724,  -851, -392, 1004, 724, -569, -392, 1004, -724, -200,  946,  -851,
+    724, -851, 392,  200,  -724, 1004, -946, 569,  724, -1004, 946, -851, 724,  -569,  392,  -200,
+};
+
+static const int16_t *idct_kernel(uint8_t size) {
+  switch (size) {
+    case 1:
+      return IDCT_KERNEL_1;
+    case 2:
+      return IDCT_KERNEL_2;
+    case 4:
+      return IDCT_KERNEL_4;
+    default:
+      return IDCT_KERNEL_8;
+  }
+}
+
+static inline uint8_t clamp_sample(int32_t value) {
+  return value < 0 ? 0 : (value > 255 ? 255 : static_cast<uint8_t>(value));
+}
+
+/**
+ * @brief Inverse DCT of a block of dequantized coefficients into width x height samples.
+ *
+ * @param coefficients The coefficients of the block, in natural order.
+ * @param dc_only Whether all AC coefficients are zero.
+ * @param width The number of samples per row, 1, 2, 4 or 8.
+ * @param height The number of rows, 1, 2, 4 or 8.
+ * @param out Where to write the samples to.
+ * @param stride Distance between rows in out.
+ */
+static void HOT idct(const int32_t *coefficients, bool dc_only, uint8_t width, uint8_t height, uint8_t *out,
+                     uint8_t stride) {
+  if (dc_only) {
+    // both passes multiply by the same C(0) / 2, so this is dc / 8
+    const uint8_t value = clamp_sample(((coefficients[0] + 4) >> 3) + 128);
+    for (uint8_t y = 0; y < height; y++)
+      memset(out + y * stride, value, width);
+    return;
+  }
+  const int16_t *kernel_x = idct_kernel(width);
+  const int16_t *kernel_y = idct_kernel(height);
+  // rows, keeping 3 fractional bits
+  int32_t tmp[64];
+  for (uint8_t v = 0; v < 8; v++) {
+    const int32_t *row = coefficients + v * 8;
+    if (!(row[1] | row[2] | row[3] | row[4] | row[5] | row[6] | row[7])) {
+      // only the first weight of each kernel row is non-zero
+      const int32_t value = (row[0] * kernel_x[0] + (1 << 7)) >> 8;
+      for (uint8_t x = 0; x < width; x++)
+        tmp[v * 8 + x] = value;
+      continue;
+    }
+    for (uint8_t x = 0; x < width; x++) {
+      const int16_t *k = kernel_x + x * 8;
+      int32_t sum = 0;
+      for (uint8_t u = 0; u < 8; u++)
+        sum += row[u] * k[u];
+      tmp[v * 8 + x] = (sum + (1 << 7)) >> 8;
+    }
+  }
+  // columns
+  for (uint8_t y = 0; y < height; y++) {
+    const int16_t *k = kernel_y + y * 8;
+    for (uint8_t x = 0; x < width; x++) {
+      int32_t sum = 0;
+      for (uint8_t v = 0; v < 8; v++)
+        sum += tmp[v * 8 + x] * k[v];
+      out[y * stride + x] = clamp_sample(((sum + (1 << 13)) >> 14) + 128);
+    }
+  }
+}
+
+static inline int32_t extend(uint32_t value, uint8_t bits) {
+  return value < (1u << (bits - 1)) ? static_cast<int32_t>(value) - static_cast<int32_t>((1u << bits) - 1)
+                                    : static_cast<int32_t>(value);
+}
+
+bool JpegBitReader::fill(uint8_t count) {
+  while (this->bit_count < count) {
+    uint8_t byte = 0;
+    if (!this->marker_hit) {
+      if (this->pos >= this->size)
+        return false;
+      byte = this->data[this->pos];
+      if (byte == 0xFF) {
+        if (this->pos + 1 >= this->size)
+          return false;
+        if (this->data[this->pos + 1] == 0x00) {
+          this->pos += 2;
+        } else {
+          this->marker_hit = true;
+          byte = 0;
+        }
+      } else {
+        this->pos++;
+      }
+    }
+    this->bits = (this->bits << 8) | byte;
+    this->bit_count += 8;
+  }
+  return true;
+}
+
+int HOT JpegDecoder::decode(uint8_t *buffer, size_t size) {
+  this->reader_.data = buffer;
+  this->reader_.size = size;
+  this->reader_.pos = 0;
+
+  Result result = Result::OK;
+  while (result == Result::OK && this->state_ != State::DONE) {
+    switch (this->state_) {
+      case State::MARKER:
+        result = this->read_marker_();
+        break;
+      case State::SEGMENT:
+        result = this->read_segment_();
+        break;
+      case State::TABLES:
+        result = this->read_tables_();
+        break;
+      case State::SKIP:
+        result = this->skip_segment_();
+        break;
+      case State::SCAN:
+        result = this->decode_scan_();
+        break;
+      default:
+        break;
+    }
+  }
+  if (result == Result::ERROR)
+    return -1;
+  if (this->state_ == State::DONE) {
+    // all MCUs have been drawn; nothing after them matters
+    this->decoded_bytes_ = this->download_size_;
+    return size;
+  }
+  this->decoded_bytes_ += this->reader_.pos;
+  return this->reader_.pos;
+}
+
+JpegDecoder::Result JpegDecoder::read_marker_() {
+  const uint8_t *data = this->reader_.data + this->reader_.pos;
+  size_t remaining = this->reader_.remaining();
+  // skip fill bytes
+  while (remaining >= 2 && data[0] == 0xFF && data[1] == 0xFF) {
+    data++;
+    remaining--;
+    this->reader_.pos++;
+  }
+  if (remaining < 2)
+    return Result::NEED_DATA;
+  if (data[0] != 0xFF) {
+    ESP_LOGE(TAG, "Expected a marker, got 0x%02X", data[0]);
+    return Result::ERROR;
+  }
+  const uint8_t marker = data[1];
+  if (marker == JPEG_SOI || (marker >= JPEG_RST0 && marker <= JPEG_RST7)) {
+    this->reader_.pos += 2;
+    return Result::OK;
+  }
+  if (marker == JPEG_EOI) {
+    ESP_LOGE(TAG, "Image ended before any image data");
+    return Result::ERROR;
+  }
+  if (remaining < 4)
+    return Result::NEED_DATA;
+  const uint16_t length = encode_uint16(data[2], data[3]);
+  if (length < 2) {
+    ESP_LOGE(TAG, "Invalid segment length %u", length);
+    return Result::ERROR;
+  }
+  this->reader_.pos += 4;
+  this->segment_marker_ = marker;
+  this->segment_left_ = length - 2;
+
+  switch (marker) {
+    case JPEG_SOF0:
+    case JPEG_SOF1:
+    case JPEG_SOS:
+    case JPEG_DRI:
+      this->state_ = State::SEGMENT;
+      break;
+    case JPEG_DHT:
+    case JPEG_DQT:
+      this->state_ = State::TABLES;
+      break;
+    case 0xC2:
+    case 0xC3:
+    case 0xC5:
+    case 0xC6:
+    case 0xC7:
+    case 0xC9:
+    case 0xCA:
+    case 0xCB:
+    case 0xCD:
+    case 0xCE:
+    case 0xCF:
+      ESP_LOGE(TAG, "Unsupported JPEG encoding (SOF 0x%02X); only baseline images can be decoded", marker);
+      return Result::ERROR;
+    default:
+      // APPn, COM and the like
+      this->state_ = State::SKIP;
+      break;
+  }
+  return Result::OK;
+}
+
+JpegDecoder::Result JpegDecoder::skip_segment_() {
+  const size_t skip = std::min(this->reader_.remaining(), static_cast<size_t>(this->segment_left_));
+  this->reader_.pos += skip;
+  this->segment_left_ -= skip;
+  if (this->segment_left_ != 0)
+    return Result::NEED_DATA;
+  this->state_ = State::MARKER;
+  return Result::OK;
+}
+
+JpegDecoder::Result JpegDecoder::read_segment_() {
+  if (this->reader_.remaining() < this->segment_left_)
+    return Result::NEED_DATA;
+  const uint8_t *data = this->reader_.data + this->reader_.pos;
+  this->reader_.pos += this->segment_left_;
+  this->state_ = State::MARKER;
+
+  switch (this->segment_marker_) {
+    case JPEG_SOF0:
+    case JPEG_SOF1:
+      return this->read_frame_(data);
+    case JPEG_SOS:
+      return this->read_scan_(data);
+    case JPEG_DRI:
+      if (this->segment_left_ < 2) {
+        ESP_LOGE(TAG, "Invalid restart interval");
+        return Result::ERROR;
+      }
+      this->restart_interval_ = encode_uint16(data[0], data[1]);
+      return Result::OK;
+    default:
+      return Result::OK;
+  }
+}
+
+JpegDecoder::Result JpegDecoder::read_tables_() {
+  while (this->segment_left_ != 0) {
+    const uint8_t *data = this->reader_.data + this->reader_.pos;
+    const size_t remaining = this->reader_.remaining();
+    if (remaining == 0)
+      return Result::NEED_DATA;
+    const uint8_t type = data[0] >> 4;
+    const uint8_t index = data[0] & 0x0F;
+
+    if (this->segment_marker_ == JPEG_DQT) {
+      const uint16_t length = type == 0 ? 65 : 129;
+      if (this->segment_left_ < length || index > 3) {
+        ESP_LOGE(TAG, "Invalid quantization table");
+        return Result::ERROR;
+      }
+      if (remaining < length)
+        return Result::NEED_DATA;
+      for (uint8_t i = 0; i < 64; i++)
+        this->quant_tables_[index][i] = type == 0 ? data[1 + i] : encode_uint16(data[1 + i * 2], data[2 + i * 2]);
+      this->quant_defined_ |= 1 << index;
+      this->reader_.pos += length;
+      this->segment_left_ -= length;
+      continue;
+    }
+
+    // DHT
+    if (this->segment_left_ < 17 || type > 1 || index > 1) {
+      ESP_LOGE(TAG, "Invalid Huffman table");
+      return Result::ERROR;
+    }
+    if (remaining < 17)
+      return Result::NEED_DATA;
+    const uint8_t *counts = data + 1;
+    uint16_t num_values = 0;
+    for (uint8_t i = 0; i < 16; i++)
+      num_values += counts[i];
+    const uint16_t length = 17 + num_values;
+    if (num_values > 256 || this->segment_left_ < length) {
+      ESP_LOGE(TAG, "Invalid Huffman table");
+      return Result::ERROR;
+    }
+    if (remaining < length)
+      return Result::NEED_DATA;
+
+    JpegHuffmanTable &table = type == 0 ? this->dc_tables_[index] : this->ac_tables_[index];
+    memcpy(table.values, data + 17, num_values);
+    memset(table.fast_length, 0, sizeof(table.fast_length));
+    int32_t code = 0;
+    int32_t value = 0;
+    for (uint8_t len = 1; len <= 16; len++) {
+      // a crafted table could have more codes than fit into their length, and overrun the lookup table
+      if (code + counts[len - 1] > (1 << len)) {
+        this->huffman_defined_ &= ~(1 << (type * 2 + index));
+        ESP_LOGE(TAG, "Invalid Huffman table");
+        return Result::ERROR;
+      }
+      table.value_offset[len] = value - code;
+      for (uint8_t i = 0; i < counts[len - 1]; i++, code++, value++) {
+        if (len <= 8) {
+          const uint16_t first = code << (8 - len);
+          for (uint16_t j = 0; j < (1u << (8 - len)); j++) {
+            table.fast_length[first + j] = len;
+            table.fast_value[first + j] = table.values[value];
+          }
+        }
+      }
+      table.max_code[len] = counts[len - 1] != 0 ? code - 1 : -1;
+      code <<= 1;
+    }
+    this->huffman_defined_ |= 1 << (type * 2 + index);
+    this->reader_.pos += length;
+    this->segment_left_ -= length;
+  }
+  this->state_ = State::MARKER;
+  return Result::OK;
+}
+
+JpegDecoder::Result JpegDecoder::read_frame_(const uint8_t *data) {
+  if (this->segment_left_ < 6 || data[0] != 8) {
+    ESP_LOGE(TAG, "Only 8 bit JPEG images are supported");
+    return Result::ERROR;
+  }
+  const int height = encode_uint16(data[1], data[2]);
+  const int width = encode_uint16(data[3], data[4]);
+  this->num_components_ = data[5];
+  if (width == 0 || height == 0) {
+    ESP_LOGE(TAG, "Invalid image size %dx%d", width, height);
+    return Result::ERROR;
+  }
+  if ((this->num_components_ != 1 && this->num_components_ != 3) ||
+      this->segment_left_ < 6 + this->num_components_ * 3) {
+    ESP_LOGE(TAG, "Only grayscale and YCbCr images are supported");
+    return Result::ERROR;
+  }
+
+  uint8_t max_h = 1;
+  uint8_t max_v = 1;
+  for (uint8_t i = 0; i < this->num_components_; i++) {
+    Component &component = this->components_[i];
+    const uint8_t *spec = data + 6 + i * 3;
+    component.id = spec[0];
+    // a single component is always coded one block at a time, whatever its sampling factors
+    component.h = this->num_components_ == 1 ? 1 : spec[1] >> 4;
+    component.v = this->num_components_ == 1 ? 1 : spec[1] & 0x0F;
+    component.quant_table = spec[2] & 0x03;
+    if (component.h < 1 || component.h > 2 || component.v < 1 || component.v > 2) {
+      ESP_LOGE(TAG, "Unsupported chroma subsampling");
+      return Result::ERROR;
+    }
+    max_h = std::max(max_h, component.h);
+    max_v = std::max(max_v, component.v);
+  }
+
+  this->scale_ = this->get_scale_down(width, height, 8);
+  const uint8_t block_size = 8 / this->scale_;
+  this->mcu_width_ = max_h * block_size;
+  this->mcu_height_ = max_v * block_size;
+  for (uint8_t i = 0; i < this->num_components_; i++) {
+    Component &component = this->components_[i];
+    // subsampled components are decoded at a higher resolution instead of being scaled up, as far as possible
+    uint8_t block_width = block_size * max_h / component.h;
+    uint8_t block_height = block_size * max_v / component.v;
+    component.repeat_x = block_width > 8 ? block_width / 8 : 1;
+    component.repeat_y = block_height > 8 ? block_height / 8 : 1;
+    component.block_width = block_width / component.repeat_x;
+    component.block_height = block_height / component.repeat_y;
+  }
+  this->mcus_x_ = (width + max_h * 8 - 1) / (max_h * 8);
+  this->mcu_count_ = static_cast<uint32_t>(this->mcus_x_) * ((height + max_v * 8 - 1) / (max_v * 8));
+  this->output_width_ = (width + this->scale_ - 1) / this->scale_;
+  this->output_height_ = (height + this->scale_ - 1) / this->scale_;
+
+  ESP_LOGD(TAG, "Image size %dx%d, %u components, decoding at 1/%u", width, height, this->num_components_,
+           this->scale_);
+  this->set_size(this->output_width_, this->output_height_);
+  return Result::OK;
+}
+
+JpegDecoder::Result JpegDecoder::read_scan_(const uint8_t *data) {
+  if (this->mcu_count_ == 0) {
+    ESP_LOGE(TAG, "Image data before the frame header");
+    return Result::ERROR;
+  }
+  if (this->segment_left_ < 1) {
+    ESP_LOGE(TAG, "Invalid scan header");
+    return Result::ERROR;
+  }
+  const uint8_t num_components = data[0];
+  if (num_components != this->num_components_ || this->segment_left_ < 4 + num_components * 2) {
+    ESP_LOGE(TAG, "Only images with a single interleaved scan are supported");
+    return Result::ERROR;
+  }
+  for (uint8_t i = 0; i < num_components; i++) {
+    const uint8_t *spec = data + 1 + i * 2;
+    Component &component = this->components_[i];
+    if (spec[0] != component.id) {
+      ESP_LOGE(TAG, "Unexpected component order in scan");
+      return Result::ERROR;
+    }
+    component.dc_table = spec[1] >> 4;
+    component.ac_table = spec[1] & 0x0F;
+    component.dc_pred = 0;
+    if (component.dc_table > 1 || component.ac_table > 1 ||
+        !(this->huffman_defined_ & (1 << component.dc_table)) ||
+        !(this->huffman_defined_ & (1 << (2 + component.ac_table))) ||
+        !(this->quant_defined_ & (1 << component.quant_table))) {
+      ESP_LOGE(TAG, "Missing tables for component %u", component.id);
+      return Result::ERROR;
+    }
+  }
+  this->reader_.reset();
+  this->restarts_left_ = this->restart_interval_;
+  this->mcu_ = 0;
+  this->block_ = 0;
+  this->state_ = State::SCAN;
+  return Result::OK;
+}
+
+JpegDecoder::Result JpegDecoder::restart_() {
+  this->reader_.reset();
+  const uint8_t *data = this->reader_.data + this->reader_.pos;
+  size_t remaining = this->reader_.remaining();
+  while (remaining >= 2 && data[0] == 0xFF && data[1] == 0xFF) {
+    data++;
+    remaining--;
+    this->reader_.pos++;
+  }
+  if (remaining < 2)
+    return Result::NEED_DATA;
+  if (data[0] == 0xFF && data[1] >= JPEG_RST0 && data[1] <= JPEG_RST7) {
+    this->reader_.pos += 2;
+  } else {
+    ESP_LOGW(TAG, "Missing restart marker at MCU %" PRIu32, this->mcu_);
+  }
+  for (uint8_t i = 0; i < this->num_components_; i++)
+    this->components_[i].dc_pred = 0;
+  this->restarts_left_ = this->restart_interval_;
+  return Result::OK;
+}
+
+int JpegDecoder::decode_huffman_(const JpegHuffmanTable &table) {
+  if (!this->reader_.fill(16))
+    return -1;
+  const uint32_t look = this->reader_.peek(16);
+  const uint8_t fast_length = table.fast_length[look >> 8];
+  if (fast_length != 0) {
+    this->reader_.skip(fast_length);
+    return table.fast_value[look >> 8];
+  }
+  for (uint8_t len = 9; len <= 16; len++) {
+    const int32_t code = look >> (16 - len);
+    if (code <= table.max_code[len]) {
+      this->reader_.skip(len);
+      return table.values[code + table.value_offset[len]];
+    }
+  }
+  return -2;
+}
+
+JpegDecoder::Result HOT JpegDecoder::decode_block_(Component &component, int32_t *coefficients, bool &dc_only) {
+  memset(coefficients, 0, 64 * sizeof(int32_t));
+  dc_only = true;
+  const uint16_t *quant = this->quant_tables_[component.quant_table];
+
+  int symbol = this->decode_huffman_(this->dc_tables_[component.dc_table]);
+  if (symbol == -1)
+    return Result::NEED_DATA;
+  if (symbol < 0 || symbol > 11) {
+    ESP_LOGE(TAG, "Corrupt image data at MCU %" PRIu32, this->mcu_);
+    return Result::ERROR;
+  }
+  int32_t dc = component.dc_pred;
+  if (symbol != 0) {
+    if (!this->reader_.fill(symbol))
+      return Result::NEED_DATA;
+    dc += extend(this->reader_.peek(symbol), symbol);
+    this->reader_.skip(symbol);
+  }
+  coefficients[0] = dc * quant[0];
+
+  for (uint8_t k = 1; k < 64; k++) {
+    symbol = this->decode_huffman_(this->ac_tables_[component.ac_table]);
+    if (symbol == -1)
+      return Result::NEED_DATA;
+    if (symbol < 0) {
+      ESP_LOGE(TAG, "Corrupt image data at MCU %" PRIu32, this->mcu_);
+      return Result::ERROR;
+    }
+    const uint8_t run = symbol >> 4;
+    const uint8_t bits = symbol & 0x0F;
+    if (bits == 0) {
+      if (run != 15)
+        break;  // end of block
+      k += 15;
+      continue;
+    }
+    k += run;
+    if (k > 63) {
+      ESP_LOGE(TAG, "Corrupt image data at MCU %" PRIu32, this->mcu_);
+      return Result::ERROR;
+    }
+    if (!this->reader_.fill(bits))
+      return Result::NEED_DATA;
+    coefficients[ZIGZAG[k]] = extend(this->reader_.peek(bits), bits) * quant[k];
+    this->reader_.skip(bits);
+    dc_only = false;
+  }
+  component.dc_pred = dc;
+  return Result::OK;
+}
+
+JpegDecoder::Result HOT JpegDecoder::decode_scan_() {
+  int32_t coefficients[64];
+  while (this->mcu_ < this->mcu_count_) {
+    if (this->block_ == 0 && this->restart_interval_ != 0 && this->restarts_left_ == 0) {
+      Result result = this->restart_();
+      if (result != Result::OK)
+        return result;
+    }
+
+    // find the component and position of the next block
+    uint8_t block = this->block_;
+    uint8_t index = 0;
+    while (index < this->num_components_ && block >= this->components_[index].h * this->components_[index].v) {
+      block -= this->components_[index].h * this->components_[index].v;
+      index++;
+    }
+    while (index < this->num_components_) {
+      Component &component = this->components_[index];
+      const JpegBitReader saved = this->reader_;
+      bool dc_only;
+      Result result = this->decode_block_(component, coefficients, dc_only);
+      if (result != Result::OK) {
+        // retry the block once more data has arrived
+        this->reader_ = saved;
+        return result;
+      }
+      const uint8_t stride = component.h * component.block_width;
+      uint8_t *out = this->samples_[index] + (block / component.h) * component.block_height * stride +
+                     (block % component.h) * component.block_width;
+      idct(coefficients, dc_only, component.block_width, component.block_height, out, stride);
+
+      this->block_++;
+      if (++block == component.h * component.v) {
+        block = 0;
+        index++;
+      }
+    }
+
+    this->draw_mcu_();
+    this->mcu_++;
+    this->block_ = 0;
+    this->restarts_left_--;
+  }
+  this->state_ = State::DONE;
+  return Result::OK;
+}
+
+void HOT JpegDecoder::draw_mcu_() {
+  const int x0 = (this->mcu_ % this->mcus_x_) * this->mcu_width_;
+  const int y0 = (this->mcu_ / this->mcus_x_) * this->mcu_height_;
+  const int width = std::min<int>(this->mcu_width_, this->output_width_ - x0);
+  const int height = std::min<int>(this->mcu_height_, this->output_height_ - y0);
+  uint8_t rgb[16 * 3];
+
+  for (int y = 0; y < height; y++) {
+    if (this->num_components_ == 1) {
+      const uint8_t *gray = this->samples_[0] + y * this->components_[0].block_width;
+      for (int x = 0; x < width; x++)
+        memset(rgb + x * 3, gray[x], 3);
+    } else {
+      const Component *components = this->components_;
+      const uint8_t *luma = this->samples_[0] + (y / components[0].repeat_y) * components[0].h *
+                                                    components[0].block_width;
+      const uint8_t *cb = this->samples_[1] + (y / components[1].repeat_y) * components[1].h *
+                                                  components[1].block_width;
+      const uint8_t *cr = this->samples_[2] + (y / components[2].repeat_y) * components[2].h *
+                                                  components[2].block_width;
+      for (int x = 0; x < width; x++) {
+        // JFIF YCbCr to RGB, with 16 fractional bits
+        const int32_t l = luma[x / components[0].repeat_x];
+        const int32_t b = cb[x / components[1].repeat_x] - 128;
+        const int32_t r = cr[x / components[2].repeat_x] - 128;
+        rgb[x * 3 + 0] = clamp_sample(l + ((91881 * r + 32768) >> 16));
+        rgb[x * 3 + 1] = clamp_sample(l + ((-22554 * b - 46802 * r + 32768) >> 16));
+        rgb[x * 3 + 2] = clamp_sample(l + ((116130 * b + 32768) >> 16));
+      }
+    }
+    this->draw_rgb_row(x0, y0 + y, width, rgb);
+  }
+}
+
+}  // namespace online_image
+}  // namespace esphome
+
+#endif  // USE_ONLINE_IMAGE_JPEG_SUPPORT
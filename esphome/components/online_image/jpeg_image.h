@@ -0,0 +1,153 @@
+#pragma once
+
+#include "image_decoder.h"
+#ifdef USE_ONLINE_IMAGE_JPEG_SUPPORT
+
+namespace esphome {
+namespace online_image {
+
+/**
+ * @brief Huffman table of a JPEG image, with a lookup table for codes of up to 8 bits.
+ */
+struct JpegHuffmanTable {
+  /** Length of the code starting with the indexed 8 bits, 0 if the code is longer. */
+  uint8_t fast_length[256];
+  /** Value of the code starting with the indexed 8 bits. */
+  uint8_t fast_value[256];
+  /** Largest code of each length, -1 if there are none. */
+  int32_t max_code[17];
+  /** Added to a code of each length to get the index of its value. */
+  int32_t value_offset[17];
+  uint8_t values[256];
+};
+
+/**
+ * @brief Reads the entropy coded data of a JPEG scan bit by bit, undoing the byte stuffing.
+ * Once a marker is reached, it is not consumed and the remaining bits read as zeros.
+ */
+struct JpegBitReader {
+  const uint8_t *data;
+  size_t size;
+  /** Position of the next byte to be read from data. */
+  size_t pos;
+  uint32_t bits;
+  uint8_t bit_count;
+  bool marker_hit;
+
+  size_t remaining() const { return this->size - this->pos; }
+  /** Make sure at least count bits are buffered; false if more data is needed first. */
+  bool fill(uint8_t count);
+  uint32_t peek(uint8_t count) const { return (this->bits >> (this->bit_count - count)) & ((1u << count) - 1); }
+  void skip(uint8_t count) { this->bit_count -= count; }
+  /** Drop the buffered bits, to continue reading at the next marker. */
+  void reset() {
+    this->bits = 0;
+    this->bit_count = 0;
+    this->marker_hit = false;
+  }
+};
+
+/**
+ * @brief Image decoder specialization for baseline JPEG images.
+ *
+ * The image is decoded one MCU (the group of 8x8 blocks covering the same area for all color components) at a
+ * time, as the data is downloaded, and drawn straight into the image buffer; only the MCU being decoded is kept
+ * in memory. When the image is resized, it is scaled down by 1/2, 1/4 or 1/8 while doing the IDCT, as long as it
+ * doesn't get smaller than the requested size.
+ *
+ * Progressive and arithmetic coded images are not supported.
+ */
+class JpegDecoder : public ImageDecoder {
+ public:
+  /**
+   * @brief Construct a new JPEG Decoder object.
+   *
+   * @param image The image to decode the stream into.
+   */
+  JpegDecoder(OnlineImage *image) : ImageDecoder(image) {}
+
+  int HOT decode(uint8_t *buffer, size_t size) override;
+
+ protected:
+  enum class State : uint8_t {
+    MARKER,
+    SEGMENT,
+    TABLES,
+    SKIP,
+    SCAN,
+    DONE,
+  };
+
+  enum class Result : uint8_t {
+    OK,
+    NEED_DATA,
+    ERROR,
+  };
+
+  struct Component {
+    uint8_t id;
+    /** Horizontal and vertical sampling factors. */
+    uint8_t h;
+    uint8_t v;
+    uint8_t quant_table;
+    uint8_t dc_table;
+    uint8_t ac_table;
+    /** Size of the samples output for each block. */
+    uint8_t block_width;
+    uint8_t block_height;
+    /** How many times each sample is repeated to cover the MCU. */
+    uint8_t repeat_x;
+    uint8_t repeat_y;
+    int32_t dc_pred;
+  };
+
+  Result read_marker_();
+  Result read_segment_();
+  Result read_tables_();
+  Result skip_segment_();
+  Result read_frame_(const uint8_t *data);
+  Result read_scan_(const uint8_t *data);
+  Result decode_scan_();
+  Result restart_();
+  int decode_huffman_(const JpegHuffmanTable &table);
+  Result decode_block_(Component &component, int32_t *coefficients, bool &dc_only);
+  void draw_mcu_();
+
+  JpegBitReader reader_{};
+  State state_{State::MARKER};
+  /** Marker of the segment being read, and the bytes of it that are still to be read. */
+  uint8_t segment_marker_{0};
+  uint16_t segment_left_{0};
+
+  uint16_t quant_tables_[4][64];
+  JpegHuffmanTable dc_tables_[2];
+  JpegHuffmanTable ac_tables_[2];
+  /** Bitmasks of the tables that have been defined. */
+  uint8_t quant_defined_{0};
+  uint8_t huffman_defined_{0};
+
+  Component components_[3];
+  uint8_t num_components_{0};
+  uint16_t restart_interval_{0};
+  uint16_t restarts_left_{0};
+
+  /** Factor the image is scaled down by while decoding. */
+  uint8_t scale_{1};
+  int output_width_{0};
+  int output_height_{0};
+  /** Size of an MCU in output pixels. */
+  uint8_t mcu_width_{0};
+  uint8_t mcu_height_{0};
+  uint16_t mcus_x_{0};
+  uint32_t mcu_count_{0};
+  /** MCU being decoded, and its next block. */
+  uint32_t mcu_{0};
+  uint8_t block_{0};
+  /** Output samples of the MCU being decoded, per component. */
+  uint8_t samples_[3][16 * 16];
+};
+
+}  // namespace online_image
+}  // namespace esphome
+
+#endif  // USE_ONLINE_IMAGE_JPEG_SUPPORT
@@ -23,7 +23,7 @@ using t_http_codes = enum {
 enum ImageFormat {
   /** Automatically detect from MIME type. Not supported yet. */
   AUTO,
-  /** JPEG format. Not supported yet. */
+  /** JPEG format. */
   JPEG,
   /** PNG format. */
   PNG,
@@ -152,6 +152,8 @@ class OnlineImage : public PollingComponent,
 
   friend void ImageDecoder::set_size(int width, int height);
   friend void ImageDecoder::draw(int x, int y, int w, int h, const Color &color);
+  friend void ImageDecoder::draw_rgb_row(int x, int y, int w, const uint8_t *rgb);
+  friend int ImageDecoder::get_scale_down(int width, int height, int max_scale) const;
 };
 
 template<typename... Ts> class OnlineImageSetUrlAction : public Action<Ts...> {
@@ -2,6 +2,7 @@ from esphome import automation
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.const import (
+    CONF_DELTA,
     CONF_ESPHOME,
     CONF_ON_ERROR,
     CONF_OTA,
@@ -44,8 +45,16 @@ def _ota_final_validate(config):
 
 FINAL_VALIDATE_SCHEMA = _ota_final_validate
 
+def _validate_delta(value):
+    value = cv.boolean(value)
+    if value and not CORE.is_esp32:
+        raise cv.Invalid("Delta updates are only supported on ESP32")
+    return value
+
+
 BASE_OTA_SCHEMA = cv.Schema(
     {
+        cv.Optional(CONF_DELTA, default=False): _validate_delta,
         cv.Optional(CONF_ON_STATE_CHANGE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(OTAStateChangeTrigger),
@@ -92,6 +101,8 @@ async def to_code(config):
 
 
 async def ota_to_code(var, config):
+    if config[CONF_DELTA]:
+        cg.add_define("USE_OTA_DELTA")
     use_state_callback = False
     for conf in config.get(CONF_ON_STATE_CHANGE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
@@ -37,6 +37,7 @@ enum OTAResponseTypes {
   OTA_RESPONSE_ERROR_NO_UPDATE_PARTITION = 0x8A,
   OTA_RESPONSE_ERROR_MD5_MISMATCH = 0x8B,
   OTA_RESPONSE_ERROR_RP2040_NOT_ENOUGH_SPACE = 0x8C,
+  OTA_RESPONSE_ERROR_DELTA_BASE_MISMATCH = 0x8D,
   OTA_RESPONSE_ERROR_UNKNOWN = 0xFF,
 };
 
@@ -4,6 +4,7 @@
 
 #include "ota_backend.h"
 #include "ota_backend_arduino_esp32.h"
+#include "ota_backend_delta.h"
 
 #include <Update.h>
 
@@ -12,7 +13,13 @@ namespace ota {
 
 static const char *const TAG = "ota.arduino_esp32";
 
-std::unique_ptr<ota::OTABackend> make_ota_backend() { return make_unique<ota::ArduinoESP32OTABackend>(); }
+std::unique_ptr<ota::OTABackend> make_ota_backend() {
+#ifdef USE_OTA_DELTA
+  return make_unique<ota::DeltaOTABackend>(make_unique<ota::ArduinoESP32OTABackend>());
+#else
+  return make_unique<ota::ArduinoESP32OTABackend>();
+#endif
+}
 
 OTAResponseTypes ArduinoESP32OTABackend::begin(size_t image_size) {
   bool ret = Update.begin(image_size, U_FLASH);
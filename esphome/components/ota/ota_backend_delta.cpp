@@ -0,0 +1,223 @@
+#include "ota_backend_delta.h"
+#ifdef USE_OTA_DELTA
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cstring>
+
+#ifdef USE_ESP32
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#endif
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.delta";
+
+static const uint8_t DELTA_MAGIC[4] = {'E', 'S', 'P', 'D'};
+static const uint8_t DELTA_VERSION = 1;
+
+static uint32_t read_le32(const uint8_t *data) {
+  return uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+}
+
+OTAResponseTypes DeltaOTABackend::begin(size_t image_size) {
+  // The inner backend is only started once it is known whether this is a delta and how large the result is
+  this->image_size_ = image_size;
+  this->state_ = State::HEADER;
+  this->header_len_ = 0;
+  this->written_ = 0;
+  this->md5_.init();
+  return OTA_RESPONSE_OK;
+}
+
+void DeltaOTABackend::set_update_md5(const char *md5) {
+  memcpy(this->expected_md5_, md5, 32);
+  this->has_expected_md5_ = true;
+  if (this->state_ == State::PASSTHROUGH)
+    this->backend_->set_update_md5(md5);
+}
+
+OTAResponseTypes DeltaOTABackend::write(uint8_t *data, size_t len) {
+  if (this->state_ == State::PASSTHROUGH)
+    return this->backend_->write(data, len);
+
+  this->md5_.add(data, len);
+  size_t pos = 0;
+  while (pos < len) {
+    OTAResponseTypes error_code = OTA_RESPONSE_OK;
+    size_t n;
+    switch (this->state_) {
+      case State::HEADER:
+        n = std::min(len - pos, sizeof(this->header_) - this->header_len_);
+        memcpy(this->header_ + this->header_len_, data + pos, n);
+        this->header_len_ += n;
+        pos += n;
+        if (this->header_len_ >= sizeof(DELTA_MAGIC) && memcmp(this->header_, DELTA_MAGIC, sizeof(DELTA_MAGIC)) != 0) {
+          ESP_LOGD(TAG, "Not a delta, writing full image");
+          this->state_ = State::PASSTHROUGH;
+          error_code = this->backend_->begin(this->image_size_);
+          if (error_code != OTA_RESPONSE_OK)
+            return error_code;
+          this->backend_started_ = true;
+          if (this->has_expected_md5_)
+            this->backend_->set_update_md5(this->expected_md5_);
+          error_code = this->backend_->write(this->header_, this->header_len_);
+          if (error_code != OTA_RESPONSE_OK || pos == len)
+            return error_code;
+          return this->backend_->write(data + pos, len - pos);
+        }
+        if (this->header_len_ == sizeof(this->header_))
+          error_code = this->start_delta_();
+        break;
+      case State::OPCODE:
+        this->opcode_ = data[pos++];
+        if (this->opcode_ != DELTA_OP_COPY && this->opcode_ != DELTA_OP_INSERT) {
+          ESP_LOGW(TAG, "Invalid delta operation 0x%02X", this->opcode_);
+          return OTA_RESPONSE_ERROR_UNKNOWN;
+        }
+        this->args_len_ = 0;
+        this->state_ = State::ARGUMENTS;
+        break;
+      case State::ARGUMENTS: {
+        uint8_t args_size = this->opcode_ == DELTA_OP_COPY ? 8 : 4;
+        n = std::min<size_t>(len - pos, args_size - this->args_len_);
+        memcpy(this->args_ + this->args_len_, data + pos, n);
+        this->args_len_ += n;
+        pos += n;
+        if (this->args_len_ == args_size)
+          error_code = this->run_operation_();
+        break;
+      }
+      case State::INSERT:
+        n = std::min<size_t>(len - pos, this->insert_remaining_);
+        error_code = this->backend_->write(data + pos, n);
+        pos += n;
+        this->written_ += n;
+        this->insert_remaining_ -= n;
+        if (this->insert_remaining_ == 0)
+          this->state_ = this->written_ == this->new_size_ ? State::DONE : State::OPCODE;
+        break;
+      default:
+        ESP_LOGW(TAG, "Unexpected data after the end of the delta");
+        return OTA_RESPONSE_ERROR_UNKNOWN;
+    }
+    if (error_code != OTA_RESPONSE_OK)
+      return error_code;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes DeltaOTABackend::start_delta_() {
+  if (this->header_[4] != DELTA_VERSION) {
+    ESP_LOGW(TAG, "Unsupported delta version %u", this->header_[4]);
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  this->base_size_ = read_le32(this->header_ + 8);
+  this->new_size_ = read_le32(this->header_ + 28);
+  ESP_LOGD(TAG, "Applying delta of %u bytes against %u bytes of the running image, result is %u bytes",
+           this->image_size_, this->base_size_, this->new_size_);
+
+  // The delta only produces the right image when applied to the exact image it was made against
+  md5::MD5Digest base_md5{};
+  base_md5.init();
+  for (uint32_t offset = 0; offset < this->base_size_; offset += sizeof(this->copy_buffer_)) {
+    size_t n = std::min<size_t>(this->base_size_ - offset, sizeof(this->copy_buffer_));
+    if (!this->read_running_(offset, this->copy_buffer_, n)) {
+      ESP_LOGW(TAG, "Could not read the running image");
+      return OTA_RESPONSE_ERROR_DELTA_BASE_MISMATCH;
+    }
+    base_md5.add(this->copy_buffer_, n);
+    // hashing a multi-MB image takes a while; this runs on the writer task, which can only yield, not feed the wdt
+    yield();
+  }
+  base_md5.calculate();
+  if (!base_md5.equals_bytes(this->header_ + 12)) {
+    ESP_LOGW(TAG, "Delta was not made against the running firmware");
+    return OTA_RESPONSE_ERROR_DELTA_BASE_MISMATCH;
+  }
+
+  OTAResponseTypes error_code = this->backend_->begin(this->new_size_);
+  if (error_code != OTA_RESPONSE_OK)
+    return error_code;
+  this->backend_started_ = true;
+  this->backend_->set_update_md5(format_hex(this->header_ + 32, 16).c_str());
+  this->state_ = this->new_size_ == 0 ? State::DONE : State::OPCODE;
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes DeltaOTABackend::run_operation_() {
+  uint32_t len = read_le32(this->opcode_ == DELTA_OP_COPY ? this->args_ + 4 : this->args_);
+  if (len > this->new_size_ - this->written_) {
+    ESP_LOGW(TAG, "Delta operation exceeds the new image size");
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  if (this->opcode_ == DELTA_OP_INSERT) {
+    this->insert_remaining_ = len;
+    this->state_ = len == 0 ? State::OPCODE : State::INSERT;
+    return OTA_RESPONSE_OK;
+  }
+  OTAResponseTypes error_code = this->copy_(read_le32(this->args_), len);
+  this->state_ = this->written_ == this->new_size_ ? State::DONE : State::OPCODE;
+  return error_code;
+}
+
+OTAResponseTypes DeltaOTABackend::copy_(uint32_t offset, uint32_t len) {
+  if (offset > this->base_size_ || len > this->base_size_ - offset) {
+    ESP_LOGW(TAG, "Delta copies from outside the running image");
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  while (len > 0) {
+    size_t n = std::min<size_t>(len, sizeof(this->copy_buffer_));
+    if (!this->read_running_(offset, this->copy_buffer_, n))
+      return OTA_RESPONSE_ERROR_UNKNOWN;
+    OTAResponseTypes error_code = this->backend_->write(this->copy_buffer_, n);
+    if (error_code != OTA_RESPONSE_OK)
+      return error_code;
+    offset += n;
+    len -= n;
+    this->written_ += n;
+    yield();
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes DeltaOTABackend::end() {
+  if (this->state_ == State::PASSTHROUGH)
+    return this->backend_->end();
+  if (this->state_ != State::DONE) {
+    ESP_LOGW(TAG, "Delta ended after %u of %u bytes", this->written_, this->new_size_);
+    this->abort();
+    return OTA_RESPONSE_ERROR_UPDATE_END;
+  }
+  this->md5_.calculate();
+  if (this->has_expected_md5_ && !this->md5_.equals_hex(this->expected_md5_)) {
+    this->abort();
+    return OTA_RESPONSE_ERROR_MD5_MISMATCH;
+  }
+  // The inner backend checks the MD5 of the new image from the header before activating it
+  return this->backend_->end();
+}
+
+void DeltaOTABackend::abort() {
+  if (this->backend_started_)
+    this->backend_->abort();
+  this->backend_started_ = false;
+}
+
+bool DeltaOTABackend::read_running_(uint32_t offset, uint8_t *data, size_t len) {
+#ifdef USE_ESP32
+  const esp_partition_t *running = esp_ota_get_running_partition();
+  if (running == nullptr || offset > running->size || len > running->size - offset)
+    return false;
+  return esp_partition_read(running, offset, data, len) == ESP_OK;
+#else
+  return false;
+#endif
+}
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_OTA_DELTA
+#include "ota_backend.h"
+
+#include "esphome/components/md5/md5.h"
+
+namespace esphome {
+namespace ota {
+
+static const uint8_t DELTA_OP_COPY = 0x01;
+static const uint8_t DELTA_OP_INSERT = 0x02;
+
+/** Applies a delta against the running firmware while it is received, writing the result to another backend.
+ *
+ * A delta starts with a header (all numbers little endian):
+ *   - magic "ESPD", version (1 byte), 3 reserved bytes
+ *   - size (4 bytes) and MD5 (16 bytes) of the running image the delta was made against
+ *   - size (4 bytes) and MD5 (16 bytes) of the new image
+ *
+ * followed by operations, each one opcode byte plus arguments:
+ *   - DELTA_OP_COPY, offset (4 bytes), length (4 bytes): copy from the running image
+ *   - DELTA_OP_INSERT, length (4 bytes), data: insert literal data
+ *
+ * The MD5 passed to set_update_md5() covers the received delta, the new image is verified against the MD5 from
+ * the header before it is activated. Data that doesn't start with the magic is passed through unchanged, so full
+ * images can still be uploaded.
+ */
+class DeltaOTABackend : public OTABackend {
+ public:
+  explicit DeltaOTABackend(std::unique_ptr<OTABackend> backend) : backend_(std::move(backend)) {}
+
+  OTAResponseTypes begin(size_t image_size) override;
+  void set_update_md5(const char *md5) override;
+  OTAResponseTypes write(uint8_t *data, size_t len) override;
+  OTAResponseTypes end() override;
+  void abort() override;
+  bool supports_compression() override { return this->backend_->supports_compression(); }
+
+ protected:
+  enum class State : uint8_t {
+    HEADER,
+    PASSTHROUGH,
+    OPCODE,
+    ARGUMENTS,
+    INSERT,
+    DONE,
+  };
+
+  /// Parse the complete header, verify the running image and start the inner backend.
+  OTAResponseTypes start_delta_();
+  /// Execute the operation whose arguments have just been received.
+  OTAResponseTypes run_operation_();
+  /// Copy len bytes at offset of the running image to the inner backend.
+  OTAResponseTypes copy_(uint32_t offset, uint32_t len);
+  /// Read from the partition the firmware is running from.
+  bool read_running_(uint32_t offset, uint8_t *data, size_t len);
+
+  std::unique_ptr<OTABackend> backend_;
+  State state_{State::HEADER};
+  bool backend_started_{false};
+  size_t image_size_{0};
+  md5::MD5Digest md5_{};
+  char expected_md5_[32];
+  bool has_expected_md5_{false};
+
+  uint8_t header_[48];
+  uint8_t header_len_{0};
+  uint8_t opcode_{0};
+  uint8_t args_[8];
+  uint8_t args_len_{0};
+  uint32_t base_size_{0};
+  uint32_t new_size_{0};
+  uint32_t written_{0};
+  uint32_t insert_remaining_{0};
+  uint8_t copy_buffer_[512];
+};
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -1,5 +1,6 @@
 #ifdef USE_ESP_IDF
 #include "ota_backend_esp_idf.h"
+#include "ota_backend_delta.h"
 
 #include "esphome/components/md5/md5.h"
 #include "esphome/core/defines.h"
@@ -14,7 +15,13 @@
 namespace esphome {
 namespace ota {
 
-std::unique_ptr<ota::OTABackend> make_ota_backend() { return make_unique<ota::IDFOTABackend>(); }
+std::unique_ptr<ota::OTABackend> make_ota_backend() {
+#ifdef USE_OTA_DELTA
+  return make_unique<ota::DeltaOTABackend>(make_unique<ota::IDFOTABackend>());
+#else
+  return make_unique<ota::IDFOTABackend>();
+#endif
+}
 
 OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
   this->partition_ = esp_ota_get_next_update_partition(nullptr);
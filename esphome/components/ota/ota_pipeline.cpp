@@ -0,0 +1,122 @@
+#include "ota_pipeline.h"
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <new>
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.pipeline";
+
+#ifdef USE_ESP32
+static const uint32_t WRITER_TASK_STACK_SIZE = 4096;
+static const UBaseType_t WRITER_TASK_PRIORITY = 1;
+#endif
+
+bool OTAPipeline::init() {
+#ifdef USE_ESP32
+  const uint8_t num_buffers = 2;
+#else
+  const uint8_t num_buffers = 1;
+#endif
+  for (uint8_t i = 0; i < num_buffers; i++) {
+    this->buffers_[i] = new (std::nothrow) uint8_t[this->buffer_size_];  // NOLINT(cppcoreguidelines-owning-memory)
+    if (this->buffers_[i] == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate %u byte buffer", this->buffer_size_);
+      return false;
+    }
+  }
+
+#ifdef USE_ESP32
+  this->chunk_queue_ = xQueueCreate(1, sizeof(Chunk));
+  this->written_ = xSemaphoreCreateBinary();
+  if (this->chunk_queue_ == nullptr || this->written_ == nullptr ||
+      xTaskCreate(OTAPipeline::writer_task, "ota_writer", WRITER_TASK_STACK_SIZE, this, WRITER_TASK_PRIORITY,
+                  &this->task_handle_) != pdPASS) {
+    ESP_LOGW(TAG, "Could not start writer task");
+    this->task_handle_ = nullptr;
+    return false;
+  }
+#endif
+  return true;
+}
+
+OTAPipeline::~OTAPipeline() {
+#ifdef USE_ESP32
+  if (this->task_handle_ != nullptr) {
+    // A chunk of length 0 stops the task once everything before it has been written
+    this->wait_written_();
+    Chunk stop{nullptr, 0};
+    xQueueSend(this->chunk_queue_, &stop, portMAX_DELAY);
+    this->in_flight_ = true;
+    this->wait_written_();
+  }
+  if (this->chunk_queue_ != nullptr)
+    vQueueDelete(this->chunk_queue_);
+  if (this->written_ != nullptr)
+    vSemaphoreDelete(this->written_);
+#endif
+  delete[] this->buffers_[0];  // NOLINT(cppcoreguidelines-owning-memory)
+  delete[] this->buffers_[1];  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+OTAResponseTypes OTAPipeline::submit(size_t len) {
+#ifdef USE_ESP32
+  // The other buffer becomes active next, so its write has to be finished first
+  this->wait_written_();
+  if (this->error_ != OTA_RESPONSE_OK)
+    return this->error_;
+  Chunk chunk{this->buffers_[this->active_], len};
+  xQueueSend(this->chunk_queue_, &chunk, portMAX_DELAY);
+  this->in_flight_ = true;
+  this->active_ ^= 1;
+#else
+  if (this->error_ != OTA_RESPONSE_OK)
+    return this->error_;
+  uint32_t start = millis();
+  this->error_ = this->backend_->write(this->buffers_[0], len);
+  this->wait_time_ms_ += millis() - start;
+#endif
+  return this->error_;
+}
+
+OTAResponseTypes OTAPipeline::flush() {
+#ifdef USE_ESP32
+  this->wait_written_();
+#endif
+  return this->error_;
+}
+
+#ifdef USE_ESP32
+void OTAPipeline::wait_written_() {
+  if (!this->in_flight_)
+    return;
+  uint32_t start = millis();
+  while (xSemaphoreTake(this->written_, pdMS_TO_TICKS(100)) != pdTRUE)
+    App.feed_wdt();
+  this->in_flight_ = false;
+  this->wait_time_ms_ += millis() - start;
+}
+
+void OTAPipeline::writer_task(void *params) {
+  OTAPipeline *pipeline = reinterpret_cast<OTAPipeline *>(params);
+  Chunk chunk;
+  while (true) {
+    xQueueReceive(pipeline->chunk_queue_, &chunk, portMAX_DELAY);
+    if (chunk.len == 0)
+      break;
+    // Keep writing nothing after an error, the caller picks it up on the next submit
+    if (pipeline->error_ == OTA_RESPONSE_OK)
+      pipeline->error_ = pipeline->backend_->write(chunk.data, chunk.len);
+    xSemaphoreGive(pipeline->written_);
+  }
+  xSemaphoreGive(pipeline->written_);
+  vTaskDelete(nullptr);
+}
+#endif
+
+}  // namespace ota
+}  // namespace esphome
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ota_backend.h"
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+namespace esphome {
+namespace ota {
+
+/** Writes OTA image data to a backend while the next chunk is being received.
+ *
+ * Two buffers are used alternately: while a separate task writes one of them to flash, the caller fills the other.
+ * On platforms without tasks, the data is written synchronously from a single buffer.
+ */
+class OTAPipeline {
+ public:
+  OTAPipeline(OTABackend *backend, size_t buffer_size) : backend_(backend), buffer_size_(buffer_size) {}
+  ~OTAPipeline();
+
+  /// Allocate the buffers and start the writer, false if that failed.
+  bool init();
+  /// The buffer to fill with the next chunk.
+  uint8_t *get_buffer() { return this->buffers_[this->active_]; }
+  size_t get_buffer_size() const { return this->buffer_size_; }
+  /// Queue the first len bytes of the buffer for writing and switch to the other buffer.
+  OTAResponseTypes submit(size_t len);
+  /// Wait until all submitted data has been written.
+  OTAResponseTypes flush();
+  /// Total time the caller spent waiting for flash writes to finish.
+  uint32_t get_wait_time_ms() const { return this->wait_time_ms_; }
+
+ protected:
+  OTABackend *backend_;
+  size_t buffer_size_;
+  uint8_t *buffers_[2]{nullptr, nullptr};
+  uint8_t active_{0};
+  uint32_t wait_time_ms_{0};
+  OTAResponseTypes error_{OTA_RESPONSE_OK};
+
+#ifdef USE_ESP32
+  struct Chunk {
+    uint8_t *data;
+    size_t len;
+  };
+
+  static void writer_task(void *params);
+  /// Block until the chunk in flight has been written.
+  void wait_written_();
+
+  TaskHandle_t task_handle_{nullptr};
+  QueueHandle_t chunk_queue_{nullptr};
+  SemaphoreHandle_t written_{nullptr};
+  bool in_flight_{false};
+#endif
+};
+
+}  // namespace ota
+}  // namespace esphome
@@ -1,56 +1,231 @@
 #include "prometheus_handler.h"
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <memory>
+
+#ifdef USE_ESP32
+#include <esp_heap_caps.h>
+#endif
+#ifdef USE_ESP8266
+#include <Esp.h>
+#endif
+#ifdef USE_RP2040
+#include <Arduino.h>
+#endif
 
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+enum PrometheusSection : uint8_t {
+  SECTION_PROCESS = 0,
+  SECTION_SENSOR,
+  SECTION_BINARY_SENSOR,
+  SECTION_FAN,
+  SECTION_LIGHT,
+  SECTION_COVER,
+  SECTION_SWITCH,
+  SECTION_LOCK,
+  SECTION_EOF,
+  SECTION_DONE,
+};
 
+// Metric families per entity type, the index is passed to add_row_()
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
-  for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+static const char *const SENSOR_FAMILIES[] = {"esphome_sensor_value", "esphome_sensor_failed"};
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
-  for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+static const char *const BINARY_SENSOR_FAMILIES[] = {"esphome_binary_sensor_value", "esphome_binary_sensor_failed"};
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
-  for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+static const char *const FAN_FAMILIES[] = {"esphome_fan_value", "esphome_fan_failed", "esphome_fan_speed",
+                                           "esphome_fan_oscillation"};
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
-  for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+static const char *const LIGHT_FAMILIES[] = {"esphome_light_state", "esphome_light_color",
+                                             "esphome_light_effect_active"};
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
-  for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+static const char *const COVER_FAMILIES[] = {"esphome_cover_value", "esphome_cover_failed", "esphome_cover_tilt"};
 #endif
+#ifdef USE_SWITCH
+static const char *const SWITCH_FAMILIES[] = {"esphome_switch_value", "esphome_switch_failed"};
+#endif
+#ifdef USE_LOCK
+static const char *const LOCK_FAMILIES[] = {"esphome_lock_value", "esphome_lock_failed"};
+#endif
+
+void PrometheusHandler::setup() {
+  this->base_->init();
+  this->base_->add_handler(this);
 
+  // The entities are known by now, so the cache never has to grow while scraping
+  size_t entities = 0;
+#ifdef USE_SENSOR
+  entities += App.get_sensors().size();
+#endif
+#ifdef USE_BINARY_SENSOR
+  entities += App.get_binary_sensors().size();
+#endif
+#ifdef USE_FAN
+  entities += App.get_fans().size();
+#endif
+#ifdef USE_LIGHT
+  entities += App.get_lights().size();
+#endif
+#ifdef USE_COVER
+  entities += App.get_covers().size();
+#endif
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
-  for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+  entities += App.get_switches().size();
+#endif
+#ifdef USE_LOCK
+  entities += App.get_locks().size();
 #endif
+  this->label_cache_.reserve(entities);
+}
 
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  const char *content_type = this->openmetrics_ ? "application/openmetrics-text; version=1.0.0; charset=utf-8"
+                                                : "text/plain; version=0.0.4; charset=utf-8";
+  // The scrape is owned by the filler and freed together with the response
+  auto scrape = std::make_shared<PrometheusScrape>();
+  scrape->openmetrics = this->openmetrics_;
+  AsyncWebServerResponse *response = req->beginChunkedResponse(
+      content_type,
+      [this, scrape](uint8_t *buffer, size_t max_len, size_t index) { return this->fill_(*scrape, buffer, max_len); });
+  req->send(response);
+}
+
+size_t PrometheusHandler::fill_(PrometheusScrape &scrape, uint8_t *buffer, size_t max_len) {
+  size_t written = 0;
+  while (written < max_len) {
+    if (scrape.offset == scrape.pending.size()) {
+      scrape.pending.clear();
+      scrape.offset = 0;
+      if (!this->render_next_(scrape))
+        break;
+      continue;
+    }
+    const size_t len = std::min(max_len - written, scrape.pending.size() - scrape.offset);
+    memcpy(buffer + written, scrape.pending.data() + scrape.offset, len);
+    written += len;
+    scrape.offset += len;
+  }
+  return written;
+}
+
+bool PrometheusHandler::render_next_(PrometheusScrape &scrape) {
+  bool section_done = true;
+  switch (scrape.section) {
+    case SECTION_PROCESS:
+      this->process_rows_(scrape);
+      break;
+#ifdef USE_SENSOR
+    case SECTION_SENSOR:
+      section_done =
+          this->render_section_(scrape, App.get_sensors(), SENSOR_FAMILIES, &PrometheusHandler::sensor_row_);
+      break;
+#endif
+#ifdef USE_BINARY_SENSOR
+    case SECTION_BINARY_SENSOR:
+      section_done = this->render_section_(scrape, App.get_binary_sensors(), BINARY_SENSOR_FAMILIES,
+                                           &PrometheusHandler::binary_sensor_row_);
+      break;
+#endif
+#ifdef USE_FAN
+    case SECTION_FAN:
+      section_done = this->render_section_(scrape, App.get_fans(), FAN_FAMILIES, &PrometheusHandler::fan_row_);
+      break;
+#endif
+#ifdef USE_LIGHT
+    case SECTION_LIGHT:
+      section_done = this->render_section_(scrape, App.get_lights(), LIGHT_FAMILIES, &PrometheusHandler::light_row_);
+      break;
+#endif
+#ifdef USE_COVER
+    case SECTION_COVER:
+      section_done = this->render_section_(scrape, App.get_covers(), COVER_FAMILIES, &PrometheusHandler::cover_row_);
+      break;
+#endif
+#ifdef USE_SWITCH
+    case SECTION_SWITCH:
+      section_done =
+          this->render_section_(scrape, App.get_switches(), SWITCH_FAMILIES, &PrometheusHandler::switch_row_);
+      break;
+#endif
 #ifdef USE_LOCK
-  this->lock_type_(stream);
-  for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+    case SECTION_LOCK:
+      section_done = this->render_section_(scrape, App.get_locks(), LOCK_FAMILIES, &PrometheusHandler::lock_row_);
+      break;
 #endif
+    case SECTION_EOF:
+      if (scrape.openmetrics)
+        scrape.pending.append("# EOF\n");
+      break;
+    case SECTION_DONE:
+      return false;
+    default:
+      // Entity type not compiled in
+      break;
+  }
+  if (section_done)
+    scrape.section++;
+  return true;
+}
+
+template<typename T, size_t N>
+bool PrometheusHandler::render_section_(PrometheusScrape &scrape, const std::vector<T *> &objs,
+                                        const char *const (&families)[N],
+                                        void (PrometheusHandler::*row)(PrometheusScrape &, T *)) {
+  if (scrape.index == 0) {
+    this->add_types_(scrape, families, N);
+  } else {
+    (this->*row)(scrape, objs[scrape.index - 1]);
+  }
+  if (++scrape.index <= objs.size())
+    return false;
+  scrape.index = 0;
+  // OpenMetrics doesn't allow interleaving metric families, so it takes one pass over the entities per family
+  if (scrape.openmetrics && ++scrape.family < N)
+    return false;
+  scrape.family = 0;
+  return true;
+}
 
-  req->send(stream);
+void PrometheusHandler::add_types_(PrometheusScrape &scrape, const char *const *families, size_t num_families) {
+  for (size_t i = 0; i < num_families; i++) {
+    if (scrape.openmetrics && i != scrape.family)
+      continue;
+    scrape.pending.append(scrape.openmetrics ? "# TYPE " : "#TYPE ");
+    scrape.pending.append(families[i]);
+    scrape.pending.append(" gauge\n");
+  }
+}
+
+void PrometheusHandler::add_row_(PrometheusScrape &scrape, const char *const *families, uint8_t family,
+                                 EntityBase *obj, const char *extra, const char *value) {
+  if (scrape.openmetrics && family != scrape.family)
+    return;
+  std::string &out = scrape.pending;
+  out.append(families[family]);
+  out.append("{");
+  out.append(this->labels_(obj));
+  out.append(extra);
+  out.append("} ");
+  out.append(value);
+  out.append("\n");
+}
+
+void PrometheusHandler::add_row_(PrometheusScrape &scrape, const char *const *families, uint8_t family,
+                                 EntityBase *obj, const char *extra, float value) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%.2f", value);
+  this->add_row_(scrape, families, family, obj, extra, buf);
 }
 
 std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
@@ -63,289 +238,171 @@ std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
   return item == relabel_map_name_.end() ? obj->get_name() : item->second;
 }
 
+const std::string &PrometheusHandler::labels_(EntityBase *obj) {
+  auto item = this->label_cache_.find(obj);
+  if (item != this->label_cache_.end())
+    return item->second;
+  std::string labels = "id=\"";
+  labels.append(this->relabel_id_(obj));
+  labels.append("\",name=\"");
+  labels.append(this->relabel_name_(obj));
+  labels.append("\"");
+  return this->label_cache_.emplace(obj, std::move(labels)).first->second;
+}
+
+void PrometheusHandler::process_rows_(PrometheusScrape &scrape) {
+  const char *type = scrape.openmetrics ? "# TYPE " : "#TYPE ";
+  std::string &out = scrape.pending;
+  char buf[96];
+
+  snprintf(buf, sizeof(buf), "%sesphome_uptime_seconds gauge\nesphome_uptime_seconds %" PRIu32 "\n", type,
+           millis() / 1000);
+  out.append(buf);
+
+  // Longest main loop iteration since the previous scrape
+  snprintf(buf, sizeof(buf), "%sesphome_loop_time_max_seconds gauge\nesphome_loop_time_max_seconds %.3f\n", type,
+           App.get_max_loop_time() / 1000.0f);
+  out.append(buf);
+  App.reset_max_loop_time();
+
+  uint32_t free_heap = 0;
+  uint32_t max_block = 0;
+#if defined(USE_ESP32)
+  free_heap = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  max_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+#elif defined(USE_ESP8266)
+  free_heap = ESP.getFreeHeap();          // NOLINT(readability-static-accessed-through-instance)
+  max_block = ESP.getMaxFreeBlockSize();  // NOLINT(readability-static-accessed-through-instance)
+#elif defined(USE_RP2040)
+  free_heap = max_block = rp2040.getFreeHeap();
+#endif
+  if (free_heap != 0) {
+    snprintf(buf, sizeof(buf), "%sesphome_heap_free_bytes gauge\nesphome_heap_free_bytes %" PRIu32 "\n", type,
+             free_heap);
+    out.append(buf);
+    snprintf(buf, sizeof(buf), "%sesphome_heap_max_block_bytes gauge\nesphome_heap_max_block_bytes %" PRIu32 "\n",
+             type, max_block);
+    out.append(buf);
+  }
+}
+
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
-}
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
+void PrometheusHandler::sensor_row_(PrometheusScrape &scrape, sensor::Sensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    this->add_row_(scrape, SENSOR_FAMILIES, 1, obj, "", "0");
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print(F("\n"));
+    std::string unit = ",unit=\"" + obj->get_unit_of_measurement() + "\"";
+    this->add_row_(scrape, SENSOR_FAMILIES, 0, obj, unit.c_str(),
+                   value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    this->add_row_(scrape, SENSOR_FAMILIES, 1, obj, "", "1");
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
-}
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
+void PrometheusHandler::binary_sensor_row_(PrometheusScrape &scrape, binary_sensor::BinarySensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    this->add_row_(scrape, BINARY_SENSOR_FAMILIES, 1, obj, "", "0");
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print(F("\n"));
+    this->add_row_(scrape, BINARY_SENSOR_FAMILIES, 0, obj, "", obj->state ? "1" : "0");
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    this->add_row_(scrape, BINARY_SENSOR_FAMILIES, 1, obj, "", "1");
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value gauge\n"));
-  stream->print(F("#TYPE esphome_fan_failed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_speed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
-}
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
+void PrometheusHandler::fan_row_(PrometheusScrape &scrape, fan::Fan *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  this->add_row_(scrape, FAN_FAMILIES, 1, obj, "", "0");
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  this->add_row_(scrape, FAN_FAMILIES, 0, obj, "", obj->state ? "1" : "0");
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print(F("\n"));
+    this->add_row_(scrape, FAN_FAMILIES, 2, obj, "", to_string(obj->speed).c_str());
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print(F("\n"));
+    this->add_row_(scrape, FAN_FAMILIES, 3, obj, "", obj->oscillating ? "1" : "0");
   }
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state gauge\n"));
-  stream->print(F("#TYPE esphome_light_color gauge\n"));
-  stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
-}
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
+void PrometheusHandler::light_row_(PrometheusScrape &scrape, light::LightState *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  this->add_row_(scrape, LIGHT_FAMILIES, 0, obj, "", obj->remote_values.is_on() ? "1" : "0");
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  this->add_row_(scrape, LIGHT_FAMILIES, 1, obj, ",channel=\"brightness\"", brightness);
+  this->add_row_(scrape, LIGHT_FAMILIES, 1, obj, ",channel=\"r\"", r);
+  this->add_row_(scrape, LIGHT_FAMILIES, 1, obj, ",channel=\"g\"", g);
+  this->add_row_(scrape, LIGHT_FAMILIES, 1, obj, ",channel=\"b\"", b);
+  this->add_row_(scrape, LIGHT_FAMILIES, 1, obj, ",channel=\"w\"", w);
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    this->add_row_(scrape, LIGHT_FAMILIES, 2, obj, ",effect=\"None\"", "0");
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
+    std::string extra = ",effect=\"" + effect + "\"";
+    this->add_row_(scrape, LIGHT_FAMILIES, 2, obj, extra.c_str(), "1");
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value gauge\n"));
-  stream->print(F("#TYPE esphome_cover_failed gauge\n"));
-}
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
+void PrometheusHandler::cover_row_(PrometheusScrape &scrape, cover::Cover *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    this->add_row_(scrape, COVER_FAMILIES, 1, obj, "", "0");
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print(F("\n"));
+    this->add_row_(scrape, COVER_FAMILIES, 0, obj, "", obj->position);
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print(F("\n"));
+      this->add_row_(scrape, COVER_FAMILIES, 2, obj, "", obj->tilt);
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    this->add_row_(scrape, COVER_FAMILIES, 1, obj, "", "1");
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value gauge\n"));
-  stream->print(F("#TYPE esphome_switch_failed gauge\n"));
-}
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
+void PrometheusHandler::switch_row_(PrometheusScrape &scrape, switch_::Switch *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  this->add_row_(scrape, SWITCH_FAMILIES, 1, obj, "", "0");
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  this->add_row_(scrape, SWITCH_FAMILIES, 0, obj, "", obj->state ? "1" : "0");
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_lock_value gauge\n"));
-  stream->print(F("#TYPE esphome_lock_failed gauge\n"));
-}
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
+void PrometheusHandler::lock_row_(PrometheusScrape &scrape, lock::Lock *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  this->add_row_(scrape, LOCK_FAMILIES, 1, obj, "", "0");
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  this->add_row_(scrape, LOCK_FAMILIES, 0, obj, "", to_string(static_cast<int>(obj->state)).c_str());
 }
 #endif
 
@@ -2,7 +2,10 @@
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
@@ -12,6 +15,20 @@
 namespace esphome {
 namespace prometheus {
 
+/** State of a single scrape.
+ *
+ * Metrics are rendered one entity at a time into `pending` and handed out in chunks, so the memory needed
+ * per scrape doesn't grow with the number of entities.
+ */
+struct PrometheusScrape {
+  std::string pending;  ///< Rendered text not yet sent.
+  size_t offset{0};     ///< Bytes of pending already sent.
+  uint8_t section{0};   ///< Entity type being rendered.
+  uint8_t family{0};    ///< Metric family rendered in the current pass (OpenMetrics only).
+  size_t index{0};      ///< Next entity of the section, 0 for the TYPE lines.
+  bool openmetrics{false};
+};
+
 class PrometheusHandler : public AsyncWebHandler, public Component {
  public:
   PrometheusHandler(web_server_base::WebServerBase *base) : base_(base) {}
@@ -23,6 +40,13 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
    */
   void set_include_internal(bool include_internal) { include_internal_ = include_internal; }
 
+  /** Determine whether the response uses the OpenMetrics text format instead of the Prometheus one.
+   * Defaults to false.
+   *
+   * @param openmetrics Whether to output OpenMetrics.
+   */
+  void set_openmetrics(bool openmetrics) { openmetrics_ = openmetrics; }
+
   /** Add the value for an entity's "id" label.
    *
    * @param obj The entity for which to set the "id" label
@@ -48,10 +72,7 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
@@ -60,60 +81,70 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
  protected:
   std::string relabel_id_(EntityBase *obj);
   std::string relabel_name_(EntityBase *obj);
+  /// The `id="...",name="..."` labels of obj, rendered once and cached.
+  const std::string &labels_(EntityBase *obj);
+
+  /// Copy up to max_len bytes of the scrape into buffer, rendering more metrics as needed. Returns 0 when done.
+  size_t fill_(PrometheusScrape &scrape, uint8_t *buffer, size_t max_len);
+  /// Render the next piece of the scrape into scrape.pending, false when everything has been rendered.
+  bool render_next_(PrometheusScrape &scrape);
+  /// Render the TYPE lines or the next entity of a section, true once the section is complete.
+  template<typename T, size_t N>
+  bool render_section_(PrometheusScrape &scrape, const std::vector<T *> &objs, const char *const (&families)[N],
+                       void (PrometheusHandler::*row)(PrometheusScrape &, T *));
+  /// Add the TYPE lines for the metric families of the current pass.
+  void add_types_(PrometheusScrape &scrape, const char *const *families, size_t num_families);
+  /// Add `family{labels extra} value` if family is rendered in the current pass.
+  void add_row_(PrometheusScrape &scrape, const char *const *families, uint8_t family, EntityBase *obj,
+                const char *extra, const char *value);
+  void add_row_(PrometheusScrape &scrape, const char *const *families, uint8_t family, EntityBase *obj,
+                const char *extra, float value);
+
+  /// Return loop time, heap and uptime of the device as prometheus data points
+  void process_rows_(PrometheusScrape &scrape);
 
 #ifdef USE_SENSOR
-  /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(PrometheusScrape &scrape, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
   /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(PrometheusScrape &scrape, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
-  /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
   /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  void fan_row_(PrometheusScrape &scrape, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
-  /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
   /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(PrometheusScrape &scrape, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
-  /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
   /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(PrometheusScrape &scrape, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
-  /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
   /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(PrometheusScrape &scrape, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
-  /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
   /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  void lock_row_(PrometheusScrape &scrape, lock::Lock *obj);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
+  bool openmetrics_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  /// Sized for all entities in setup(), it is filled as they are first rendered.
+  std::unordered_map<EntityBase *, std::string> label_cache_;
 };
 
 }  // namespace prometheus
@@ -47,10 +47,13 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t frame = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), frame_(frame) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
+  /// Sequence number of the received frame, 0 if unknown. Used to share decode results between listeners.
+  uint32_t get_frame() const { return this->frame_; }
   uint32_t get_index() const { return index_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
@@ -99,6 +102,7 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t frame_;
 };
 
 class RemoteComponentBase {
@@ -198,9 +202,15 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void call_listeners_();
   void call_dumpers_();
   void call_listeners_dumpers_() {
+    // new frame number, so cached decode results of the previous frame are not reused
+    if (++this->frame_ == 0)
+      this->frame_ = 1;
     this->call_listeners_();
     this->call_dumpers_();
   }
+  RemoteReceiveData receive_data_() const {
+    return RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_);
+  }
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
@@ -208,6 +218,7 @@ class RemoteReceiverBase : public RemoteComponentBase {
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
+  uint32_t frame_{0};
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -230,14 +241,29 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/// Decode a received frame with protocol T. Binary sensors, triggers and dumpers of the same protocol are all called
+/// for every frame; the result is kept so the timings are only walked once per protocol instead of once per listener.
+template<typename T> optional<typename T::ProtocolData> decode_shared(RemoteReceiveData src) {
+  static const RawTimings *last_data = nullptr;
+  static uint32_t last_frame = 0;
+  static optional<typename T::ProtocolData> last_result;
+  if (src.get_frame() == 0)
+    return T().decode(src);
+  if (last_frame != src.get_frame() || last_data != &src.get_raw_data()) {
+    last_result = T().decode(src);
+    last_frame = src.get_frame();
+    last_data = &src.get_raw_data();
+  }
+  return last_result;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_shared<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -252,8 +278,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_shared<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -294,11 +319,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_shared<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
@@ -26,6 +26,8 @@ class RpiDpiRgb : public display::Display {
   void loop() override;
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
                       display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
+  void draw_pixel_row_at(int x_start, int y, int w, const uint8_t *ptr, display::ColorOrder order,
+                         display::ColorBitness bitness, bool big_endian) override;
   void draw_pixel_at(int x, int y, Color color) override;
 
   display::ColorOrder get_color_mode() { return this->color_mode_; }
@@ -100,6 +100,10 @@ template<typename... Ts> class SensorInRangeCondition : public Condition<Ts...>
       return this->min_ <= state && state <= this->max_;
     }
   }
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    this->parent_->add_on_state_callback([callback = std::move(callback)](float) { callback(); });
+    return true;
+  }
 
  protected:
   Sensor *parent_;
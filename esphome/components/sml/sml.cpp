@@ -1,4 +1,5 @@
 #include "sml.h"
+#include <algorithm>
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "sml_parser.h"
@@ -12,7 +13,35 @@ const char START_BYTES_DETECTED = 1;
 const char END_BYTES_DETECTED = 2;
 
 SmlListener::SmlListener(std::string server_id, std::string obis_code)
-    : server_id(std::move(server_id)), obis_code(std::move(obis_code)) {}
+    : server_id(std::move(server_id)), obis_code(std::move(obis_code)) {
+  unsigned a = 0, b = 0, c = 0, d = 0, e = 0;
+  sscanf(this->obis_code.c_str(), "%u-%u:%u.%u.%u", &a, &b, &c, &d, &e);
+  this->obis_key = obis_code_key(a, b, c, d, e);
+}
+
+static char hex_char(uint8_t v) { return v >= 10 ? 'a' + (v - 10) : '0' + v; }
+
+/// Whether buffer is represented by the lowercase hex string repr, without formatting it.
+static bool matches_hex_repr(const BytesView &buffer, const std::string &repr) {
+  if (repr.size() != buffer.size * 2)
+    return false;
+  for (size_t i = 0; i < buffer.size; i++) {
+    if (repr[2 * i] != hex_char(buffer[i] >> 4) || repr[2 * i + 1] != hex_char(buffer[i] & 0x0f))
+      return false;
+  }
+  return true;
+}
+
+/// Format up to N / 2 bytes of buffer as hex into out, true if buffer had to be cut short.
+template<size_t N> static bool hex_repr(const BytesView &buffer, char (&out)[N]) {
+  size_t len = std::min(buffer.size, (N - 1) / 2);
+  for (size_t i = 0; i < len; i++) {
+    out[2 * i] = hex_char(buffer[i] >> 4);
+    out[2 * i + 1] = hex_char(buffer[i] & 0x0f);
+  }
+  out[2 * len] = '\0';
+  return len < buffer.size;
+}
 
 char Sml::check_start_end_bytes_(uint8_t byte) {
   this->incoming_mask_ = (this->incoming_mask_ << 2) | get_code(byte);
@@ -25,40 +54,44 @@ char Sml::check_start_end_bytes_(uint8_t byte) {
 }
 
 void Sml::loop() {
-  while (available()) {
-    const char c = read();
-
-    if (this->record_)
-      this->sml_data_.emplace_back(c);
-
-    switch (this->check_start_end_bytes_(c)) {
-      case START_BYTES_DETECTED: {
-        this->record_ = true;
-        this->sml_data_.clear();
-        // add start sequence (for callbacks)
-        this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
-        break;
+  const uint8_t *data;
+  size_t len;
+  while ((len = this->peek_rx(&data)) > 0) {
+    for (size_t i = 0; i < len; i++) {
+      const char c = data[i];
+
+      if (this->record_)
+        this->sml_data_.emplace_back(c);
+
+      switch (this->check_start_end_bytes_(c)) {
+        case START_BYTES_DETECTED: {
+          this->record_ = true;
+          this->sml_data_.clear();
+          // add start sequence (for callbacks)
+          this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
+          break;
+        };
+        case END_BYTES_DETECTED: {
+          if (this->record_) {
+            this->record_ = false;
+
+            bool valid = check_sml_data(this->sml_data_);
+
+            // call callbacks
+            this->data_callbacks_.call(this->sml_data_, valid);
+
+            if (!valid)
+              break;
+
+            // parse without the start/end sequence
+            this->process_sml_file_(this->sml_data_.data() + START_SEQ.size(),
+                                    this->sml_data_.size() - START_SEQ.size() - 8);
+          }
+          break;
+        };
       };
-      case END_BYTES_DETECTED: {
-        if (this->record_) {
-          this->record_ = false;
-
-          bool valid = check_sml_data(this->sml_data_);
-
-          // call callbacks
-          this->data_callbacks_.call(this->sml_data_, valid);
-
-          if (!valid)
-            break;
-
-          // remove start/end sequence
-          this->sml_data_.erase(this->sml_data_.begin(), this->sml_data_.begin() + START_SEQ.size());
-          this->sml_data_.resize(this->sml_data_.size() - 8);
-          this->process_sml_file_(this->sml_data_);
-        }
-        break;
-      };
-    };
+    }
+    this->consume_rx(len);
   }
 }
 
@@ -66,44 +99,47 @@ void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &
   this->data_callbacks_.add(std::move(callback));
 }
 
-void Sml::process_sml_file_(const bytes &sml_data) {
-  SmlFile sml_file = SmlFile(sml_data);
-  std::vector<ObisInfo> obis_info = sml_file.get_obis_info();
-  this->publish_obis_info_(obis_info);
-
-  this->log_obis_info_(obis_info);
-}
-
-void Sml::log_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
+void Sml::process_sml_file_(const uint8_t *data, size_t len) {
   ESP_LOGD(TAG, "OBIS info:");
-  for (auto const &obis_info : obis_info_vec) {
-    std::string info;
-    info += "  (" + bytes_repr(obis_info.server_id) + ") ";
-    info += obis_info.code_repr();
-    info += " [0x" + bytes_repr(obis_info.value) + "]";
-    ESP_LOGD(TAG, "%s", info.c_str());
-  }
+  SmlParser parser(data, len);
+  bool valid = parser.parse([this](const ObisInfo &obis_info) {
+    this->log_obis_info_(obis_info);
+    this->publish_value_(obis_info);
+  });
+  if (!valid)
+    ESP_LOGW(TAG, "Malformed SML data, ignoring the rest of it.");
 }
 
-void Sml::publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
-  for (auto const &obis_info : obis_info_vec) {
-    this->publish_value_(obis_info);
-  }
+void Sml::log_obis_info_(const ObisInfo &obis_info) {
+  // Formatted on the stack, long values are cut short
+  char server_id[2 * 16 + 1];
+  char value[2 * 32 + 1];
+  hex_repr(obis_info.server_id, server_id);
+  bool truncated = hex_repr(obis_info.value, value);
+  ESP_LOGD(TAG, "  (%s) %d-%d:%d.%d.%d [0x%s%s]", server_id, obis_info.code[0], obis_info.code[1], obis_info.code[2],
+           obis_info.code[3], obis_info.code[4], value, truncated ? "..." : "");
 }
 
 void Sml::publish_value_(const ObisInfo &obis_info) {
-  for (auto const &sml_listener : sml_listeners_) {
-    if ((!sml_listener->server_id.empty()) && (bytes_repr(obis_info.server_id) != sml_listener->server_id))
+  // Listeners are sorted by OBIS code, so only the ones for this code are looked at
+  uint64_t key = obis_info.code_key();
+  auto it = std::lower_bound(this->sml_listeners_.begin(), this->sml_listeners_.end(), key,
+                             [](const SmlListener *listener, uint64_t key) { return listener->obis_key < key; });
+  for (; it != this->sml_listeners_.end() && (*it)->obis_key == key; ++it) {
+    if ((!(*it)->server_id.empty()) && !matches_hex_repr(obis_info.server_id, (*it)->server_id))
       continue;
-    if (obis_info.code_repr() != sml_listener->obis_code)
-      continue;
-    sml_listener->publish_val(obis_info);
+    (*it)->publish_val(obis_info);
   }
 }
 
 void Sml::dump_config() { ESP_LOGCONFIG(TAG, "SML:"); }
 
-void Sml::register_sml_listener(SmlListener *listener) { sml_listeners_.emplace_back(listener); }
+void Sml::register_sml_listener(SmlListener *listener) {
+  auto it = std::upper_bound(
+      this->sml_listeners_.begin(), this->sml_listeners_.end(), listener,
+      [](const SmlListener *a, const SmlListener *b) { return a->obis_key < b->obis_key; });
+  this->sml_listeners_.insert(it, listener);
+}
 
 bool check_sml_data(const bytes &buffer) {
   if (buffer.size() < 2) {
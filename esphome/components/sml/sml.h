@@ -14,6 +14,8 @@ class SmlListener {
  public:
   std::string server_id;
   std::string obis_code;
+  /// obis_code packed like ObisInfo::code_key(), listeners are sorted by it.
+  uint64_t obis_key{0};
   SmlListener(std::string server_id, std::string obis_code);
   virtual void publish_val(const ObisInfo &obis_info){};
 };
@@ -27,9 +29,8 @@ class Sml : public Component, public uart::UARTDevice {
   void add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback);
 
  protected:
-  void process_sml_file_(const bytes &sml_data);
-  void log_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
-  void publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
+  void process_sml_file_(const uint8_t *data, size_t len);
+  void log_obis_info_(const ObisInfo &obis_info);
   char check_start_end_bytes_(uint8_t byte);
   void publish_value_(const ObisInfo &obis_info);
 
@@ -5,113 +5,173 @@
 namespace esphome {
 namespace sml {
 
-SmlFile::SmlFile(bytes buffer) : buffer_(std::move(buffer)) {
-  // extract messages
-  this->pos_ = 0;
-  while (this->pos_ < this->buffer_.size()) {
-    if (this->buffer_[this->pos_] == 0x00)
-      break;  // EndOfSmlMsg
-
-    SmlNode message = SmlNode();
-    if (!this->setup_node(&message))
-      break;
-    this->messages.emplace_back(message);
+bool SmlParser::parse(const std::function<void(const ObisInfo &)> &callback) {
+  while (this->pos_ < this->end_) {
+    if (*this->pos_ == 0x00)
+      break;  // EndOfSmlMsg, only padding follows
+    if (!this->parse_message_(callback))
+      return false;
   }
+  return true;
 }
 
-bool SmlFile::setup_node(SmlNode *node) {
+bool SmlParser::read_tl_(uint8_t &type, size_t &length) {
+  if (this->pos_ >= this->end_)
+    return false;
+
   // If the TL field is 0x00, this is the end of the message
   // (see 6.3.1 of SML protocol definition)
-  if (this->buffer_[this->pos_] == 0x00) {
-    // Increment past this byte and signal that the message is done
+  if (*this->pos_ == 0x00) {
     this->pos_ += 1;
+    type = SML_OCTET;
+    length = 0;
     return true;
   }
 
-  // Extract data from initial TL field
-  uint8_t type = (this->buffer_[this->pos_] >> 4) & 0x07;     // type without overlength info
-  bool overlength = (this->buffer_[this->pos_] >> 4) & 0x08;  // overlength information
-  uint8_t length = this->buffer_[this->pos_] & 0x0f;          // length (including TL bytes)
-
-  // Check if we need additional length bytes
-  if (overlength) {
-    // Shift the current length to the higher nibble
-    // and add the lower nibble of the next byte to the length
-    length = (length << 4) + (this->buffer_[this->pos_ + 1] & 0x0f);
-    // We are basically done with the first TL field now,
-    // so increment past that, we now point to the second TL field
-    this->pos_ += 1;
-    // Decrement the length for value fields (not lists),
-    // since the byte we just handled is counted as part of the field
-    // in case of values but not for lists
-    if (type != SML_LIST)
-      length -= 1;
-
-    // Technically, this is not enough, the standard allows for more than two length fields.
-    // However I don't think it is very common to have more than 255 entries in a list
+  uint8_t tl = this->pos_[0];
+  type = (tl >> 4) & 0x07;  // type without overlength info
+  size_t len = tl & 0x0f;
+  size_t tl_bytes = 1;
+  // While the overlength bit is set, the lower nibble of the next byte is appended to the length
+  while (tl & 0x80) {
+    if (tl_bytes == 4 || this->pos_ + tl_bytes >= this->end_)
+      return false;
+    tl = this->pos_[tl_bytes++];
+    len = (len << 4) | (tl & 0x0f);
   }
+  this->pos_ += tl_bytes;
+
+  // Lists count their entries, values their bytes including the TL field(s)
+  if (type != SML_LIST) {
+    if (len < tl_bytes)
+      return false;
+    len -= tl_bytes;
+    if (len > static_cast<size_t>(this->end_ - this->pos_))
+      return false;
+  }
+  length = len;
+  return true;
+}
 
-  // We are done with the last TL field(s), so advance the position
-  this->pos_ += 1;
-  // and decrement the length for non-list fields
-  if (type != SML_LIST)
-    length -= 1;
-
-  // Check if the buffer length is long enough
-  if (this->pos_ + length > this->buffer_.size())
+bool SmlParser::read_value_(uint8_t &type, BytesView &value) {
+  size_t length;
+  if (!this->read_tl_(type, length))
     return false;
+  if (type == SML_LIST) {
+    value = BytesView();
+    return this->skip_(length);
+  }
+  value = BytesView(this->pos_, length);
+  this->pos_ += length;
+  return true;
+}
 
-  node->type = type;
-  node->nodes.clear();
-  node->value_bytes.clear();
+bool SmlParser::read_list_(size_t &length) {
+  uint8_t type;
+  return this->read_tl_(type, length) && type == SML_LIST;
+}
 
-  if (type == SML_LIST) {
-    node->nodes.reserve(length);
-    for (size_t i = 0; i != length; i++) {
-      SmlNode child_node = SmlNode();
-      if (!this->setup_node(&child_node))
-        return false;
-      node->nodes.emplace_back(child_node);
+bool SmlParser::skip_(size_t count) {
+  // Iterative rather than recursive, so deeply nested data can't exhaust the stack
+  while (count > 0) {
+    uint8_t type;
+    size_t length;
+    if (!this->read_tl_(type, length))
+      return false;
+    count--;
+    if (type == SML_LIST) {
+      count += length;
+    } else {
+      this->pos_ += length;
     }
-  } else {
-    // Value starts at the current position
-    // Value ends "length" bytes later,
-    // (since the TL field is counted but already subtracted from length)
-    node->value_bytes = bytes(this->buffer_.begin() + this->pos_, this->buffer_.begin() + this->pos_ + length);
-    // Increment the pointer past all consumed bytes
-    this->pos_ += length;
   }
   return true;
 }
 
-std::vector<ObisInfo> SmlFile::get_obis_info() {
-  std::vector<ObisInfo> obis_info;
-  for (auto const &message : messages) {
-    SmlNode message_body = message.nodes[3];
-    uint16_t message_type = bytes_to_uint(message_body.nodes[0].value_bytes);
-    if (message_type != SML_GET_LIST_RES)
-      continue;
+bool SmlParser::parse_message_(const std::function<void(const ObisInfo &)> &callback) {
+  // transactionId, groupNo, abortOnError, messageBody, crc16, endOfSmlMsg
+  size_t length;
+  if (!this->read_list_(length))
+    return false;
+  if (length < 4)
+    return this->skip_(length);
+  if (!this->skip_(3))
+    return false;
 
-    SmlNode get_list_response = message_body.nodes[1];
-    bytes server_id = get_list_response.nodes[1].value_bytes;
-    SmlNode val_list = get_list_response.nodes[4];
+  // messageBody is a choice of the message type and its content
+  size_t body_length;
+  if (!this->read_list_(body_length))
+    return false;
+  if (body_length < 2)
+    return this->skip_(body_length) && this->skip_(length - 4);
 
-    for (auto const &val_list_entry : val_list.nodes) {
-      obis_info.emplace_back(server_id, val_list_entry);
-    }
+  uint8_t type;
+  BytesView message_type;
+  if (!this->read_value_(type, message_type))
+    return false;
+  if (bytes_to_uint(message_type) == SML_GET_LIST_RES) {
+    if (!this->parse_get_list_response_(callback))
+      return false;
+  } else if (!this->skip_(1)) {
+    return false;
   }
-  return obis_info;
+  return this->skip_(body_length - 2) && this->skip_(length - 4);
 }
 
-std::string bytes_repr(const bytes &buffer) {
-  std::string repr;
-  for (auto const value : buffer) {
-    repr += str_sprintf("%02x", value & 0xff);
+bool SmlParser::parse_get_list_response_(const std::function<void(const ObisInfo &)> &callback) {
+  // clientId, serverId, listName, actSensorTime, valList, listSignature, actGatewayTime
+  size_t length;
+  if (!this->read_list_(length))
+    return false;
+  if (length < 5)
+    return this->skip_(length);
+
+  ObisInfo info;
+  uint8_t type;
+  if (!this->skip_(1) || !this->read_value_(type, info.server_id) || !this->skip_(2))
+    return false;
+
+  size_t entries;
+  if (!this->read_list_(entries))
+    return false;
+  for (size_t i = 0; i < entries; i++) {
+    if (!this->parse_list_entry_(info))
+      return false;
+    if (info.code.size >= 5)
+      callback(info);
   }
-  return repr;
+  return this->skip_(length - 5);
 }
 
-uint64_t bytes_to_uint(const bytes &buffer) {
+bool SmlParser::parse_list_entry_(ObisInfo &info) {
+  // objName, status, valTime, unit, scaler, value, valueSignature
+  size_t length;
+  if (!this->read_list_(length))
+    return false;
+  info.code = BytesView();
+  if (length < 6)
+    return this->skip_(length);
+
+  uint8_t type;
+  BytesView unit;
+  BytesView scaler;
+  if (!this->read_value_(type, info.code) || !this->read_value_(type, info.status) || !this->skip_(1) ||
+      !this->read_value_(type, unit) || !this->read_value_(type, scaler) || !this->read_value_(type, info.value))
+    return false;
+  info.unit = bytes_to_uint(unit);
+  info.scaler = bytes_to_int(scaler);
+  info.value_type = type;
+  return this->skip_(length - 6);
+}
+
+uint64_t obis_code_key(uint16_t a, uint16_t b, uint16_t c, uint16_t d, uint16_t e) {
+  // 12 bits per group, so the codes of the config (up to 999 per group) can't collide with received ones
+  return (uint64_t(a) << 48) | (uint64_t(b) << 36) | (uint64_t(c) << 24) | (uint64_t(d) << 12) | uint64_t(e);
+}
+
+std::string bytes_repr(const BytesView &buffer) { return format_hex(buffer.data, buffer.size); }
+
+uint64_t bytes_to_uint(const BytesView &buffer) {
   uint64_t val = 0;
   for (auto const value : buffer) {
     val = (val << 8) + value;
@@ -119,14 +179,17 @@ uint64_t bytes_to_uint(const bytes &buffer) {
   return val;
 }
 
-int64_t bytes_to_int(const bytes &buffer) {
+int64_t bytes_to_int(const BytesView &buffer) {
+  if (buffer.empty())
+    return 0;
+
   uint64_t tmp = bytes_to_uint(buffer);
   int64_t val;
 
   // sign extension for abbreviations of leading ones (e.g. 3 byte transmissions, see 6.2.2 of SML protocol definition)
   // see https://stackoverflow.com/questions/42534749/signed-extension-from-24-bit-to-32-bit-in-c
-  if (buffer.size() < 8) {
-    const int bits = buffer.size() * 8;
+  if (buffer.size < 8) {
+    const int bits = buffer.size * 8;
     const uint64_t m = 1ull << (bits - 1);
     tmp = (tmp ^ m) - m;
   }
@@ -135,21 +198,15 @@ int64_t bytes_to_int(const bytes &buffer) {
   return val;
 }
 
-std::string bytes_to_string(const bytes &buffer) { return std::string(buffer.begin(), buffer.end()); }
-
-ObisInfo::ObisInfo(bytes server_id, SmlNode val_list_entry) : server_id(std::move(server_id)) {
-  this->code = val_list_entry.nodes[0].value_bytes;
-  this->status = val_list_entry.nodes[1].value_bytes;
-  this->unit = bytes_to_uint(val_list_entry.nodes[3].value_bytes);
-  this->scaler = bytes_to_int(val_list_entry.nodes[4].value_bytes);
-  SmlNode value_node = val_list_entry.nodes[5];
-  this->value = value_node.value_bytes;
-  this->value_type = value_node.type;
-}
+std::string bytes_to_string(const BytesView &buffer) { return std::string(buffer.begin(), buffer.end()); }
 
 std::string ObisInfo::code_repr() const {
   return str_sprintf("%d-%d:%d.%d.%d", this->code[0], this->code[1], this->code[2], this->code[3], this->code[4]);
 }
 
+uint64_t ObisInfo::code_key() const {
+  return obis_code_key(this->code[0], this->code[1], this->code[2], this->code[3], this->code[4]);
+}
+
 }  // namespace sml
 }  // namespace esphome
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <functional>
 #include <string>
 #include <vector>
 #include "constants.h"
@@ -11,44 +12,73 @@ namespace sml {
 
 using bytes = std::vector<uint8_t>;
 
-class SmlNode {
- public:
-  uint8_t type;
-  bytes value_bytes;
-  std::vector<SmlNode> nodes;
+/// Non-owning view of some bytes of the SML data being parsed.
+struct BytesView {
+  const uint8_t *data{nullptr};
+  size_t size{0};
+
+  BytesView() = default;
+  BytesView(const uint8_t *data, size_t size) : data(data), size(size) {}
+  BytesView(const bytes &buffer) : data(buffer.data()), size(buffer.size()) {}  // NOLINT
+
+  const uint8_t *begin() const { return this->data; }
+  const uint8_t *end() const { return this->data + this->size; }
+  bool empty() const { return this->size == 0; }
+  uint8_t operator[](size_t i) const { return this->data[i]; }
 };
 
+/// An entry of a GetListResponse. The views point into the SML data and are only valid while it is being parsed.
 class ObisInfo {
  public:
-  ObisInfo(bytes server_id, SmlNode val_list_entry);
-  bytes server_id;
-  bytes code;
-  bytes status;
-  char unit;
-  char scaler;
-  bytes value;
-  uint16_t value_type;
+  BytesView server_id;
+  BytesView code;
+  BytesView status;
+  char unit{0};
+  char scaler{0};
+  BytesView value;
+  uint16_t value_type{SML_UNDEFINED};
   std::string code_repr() const;
+  /// The first five groups of the OBIS code packed into an integer, for looking up listeners.
+  uint64_t code_key() const;
 };
 
-class SmlFile {
+/**
+ * Walks the messages of an SML file in place and calls the callback for every value list entry of a
+ * GetListResponse, without building a tree of the file or copying any of its values.
+ */
+class SmlParser {
  public:
-  SmlFile(bytes buffer);
-  bool setup_node(SmlNode *node);
-  std::vector<SmlNode> messages;
-  std::vector<ObisInfo> get_obis_info();
+  SmlParser(const uint8_t *data, size_t size) : pos_(data), end_(data + size) {}
+
+  /// Parse the file, false if it is malformed. Entries found before the error have been passed to the callback.
+  bool parse(const std::function<void(const ObisInfo &)> &callback);
 
  protected:
-  const bytes buffer_;
-  size_t pos_;
+  /// Read a type-length field; length is the number of entries for lists and of value bytes otherwise.
+  bool read_tl_(uint8_t &type, size_t &length);
+  /// Read a value, a list is skipped and returned without data.
+  bool read_value_(uint8_t &type, BytesView &value);
+  /// Read a list, false if the next element is something else.
+  bool read_list_(size_t &length);
+  /// Skip count elements, including everything nested in them.
+  bool skip_(size_t count);
+  bool parse_message_(const std::function<void(const ObisInfo &)> &callback);
+  bool parse_get_list_response_(const std::function<void(const ObisInfo &)> &callback);
+  bool parse_list_entry_(ObisInfo &info);
+
+  const uint8_t *pos_;
+  const uint8_t *end_;
 };
 
-std::string bytes_repr(const bytes &buffer);
+/// Pack the groups of an OBIS code like the ones of ObisInfo::code_key().
+uint64_t obis_code_key(uint16_t a, uint16_t b, uint16_t c, uint16_t d, uint16_t e);
+
+std::string bytes_repr(const BytesView &buffer);
 
-uint64_t bytes_to_uint(const bytes &buffer);
+uint64_t bytes_to_uint(const BytesView &buffer);
 
-int64_t bytes_to_int(const bytes &buffer);
+int64_t bytes_to_int(const BytesView &buffer);
 
-std::string bytes_to_string(const bytes &buffer);
+std::string bytes_to_string(const BytesView &buffer);
 }  // namespace sml
 }  // namespace esphome
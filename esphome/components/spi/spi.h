@@ -234,6 +234,14 @@ class SPIDelegate {
       this->transfer(ptr[i]);
   }
 
+  // start writing the contents of a buffer. Where the hardware supports it this returns before the transfer has
+  // finished, so the caller can prepare the next block meanwhile. The buffer must stay unchanged until
+  // wait_write_complete() has confirmed the write is done. The default implementation writes synchronously.
+  virtual void write_array_async(const uint8_t *ptr, size_t length) { this->write_array(ptr, length); }
+
+  // block until no more than `pending` writes started with write_array_async() are still in progress.
+  virtual void wait_write_complete(size_t pending) {}
+
   // read into a buffer, write nulls
   virtual void read_array(uint8_t *ptr, size_t length) {
     for (size_t i = 0; i != length; i++)
@@ -466,6 +474,21 @@ class SPIDevice : public SPIClient {
 
   void write_array(const uint8_t *data, size_t length) { this->delegate_->write_array(data, length); }
 
+  /**
+   * Start writing the array data in the background, where supported (ESP-IDF hardware SPI). The data must not be
+   * modified until wait_write_complete() confirms the write is done; other transfers and disable() wait for it.
+   * Together with wait_write_complete(1) this allows double buffering: fill one buffer while the other is sent.
+   * @param data
+   * @param length
+   */
+  void write_array_async(const uint8_t *data, size_t length) { this->delegate_->write_array_async(data, length); }
+
+  /**
+   * Wait for background writes started with write_array_async() to finish.
+   * @param pending The number of most recently started writes that may still be in progress.
+   */
+  void wait_write_complete(size_t pending = 0) { this->delegate_->wait_write_complete(pending); }
+
   template<size_t N> void write_array(const std::array<uint8_t, N> &data) { this->write_array(data.data(), N); }
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
@@ -7,6 +7,7 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+static const size_t ASYNC_QUEUE_SIZE = 4;      // number of interrupt transfers that may be queued at once.
 
 class SPIDelegateHw : public SPIDelegate {
  public:
@@ -18,7 +19,7 @@ class SPIDelegateHw : public SPIDelegate {
     config.clock_speed_hz = static_cast<int>(data_rate);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = ASYNC_QUEUE_SIZE;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (bit_order == BIT_ORDER_LSB_FIRST)
@@ -44,6 +45,7 @@ class SPIDelegateHw : public SPIDelegate {
 
   void end_transaction() override {
     if (this->is_ready()) {
+      this->wait_write_complete(0);
       SPIDelegate::end_transaction();
       spi_device_release_bus(this->handle_);
     }
@@ -57,13 +59,19 @@ class SPIDelegateHw : public SPIDelegate {
 
   // do a transfer. either txbuf or rxbuf (but not both) may be null.
   // transfers above the maximum size will be split.
-  // TODO - make use of the queue for interrupt transfers to provide a (short) pipeline of blocks
-  // when splitting is required.
   void transfer(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) override {
     if (rxbuf != nullptr && this->write_only_) {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    if (rxbuf == nullptr && length > MAX_TRANSFER_SIZE) {
+      // queue the blocks as interrupt transfers so they follow each other without a gap
+      this->write_array_async(txbuf, length);
+      this->wait_write_complete(0);
+      return;
+    }
+    // polling transfers may not be mixed with queued ones
+    this->wait_write_complete(0);
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -90,6 +98,7 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   void write(uint16_t data, size_t num_bits) override {
+    this->wait_write_complete(0);
     spi_transaction_ext_t desc = {};
     desc.command_bits = num_bits;
     desc.base.flags = SPI_TRANS_VARIABLE_CMD;
@@ -121,6 +130,7 @@ class SPIDelegateHw : public SPIDelegate {
       esph_log_w(TAG, "Nothing to transfer");
       return;
     }
+    this->wait_write_complete(0);
     desc.base.flags = SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_DUMMY;
     if (bus_width == 4) {
       desc.base.flags |= SPI_TRANS_MODE_QIO;
@@ -188,10 +198,50 @@ class SPIDelegateHw : public SPIDelegate {
 
   void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
 
+  // queue the buffer as interrupt transfers, one descriptor per block. If all descriptors are in use, wait for the
+  // oldest one to complete.
+  void write_array_async(const uint8_t *ptr, size_t length) override {
+    while (length != 0) {
+      if (this->async_pending_ == ASYNC_QUEUE_SIZE)
+        this->wait_write_complete(ASYNC_QUEUE_SIZE - 1);
+      size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+      spi_transaction_t *desc = &this->async_desc_[this->async_next_];
+      *desc = {};
+      desc->length = partial * 8;
+      desc->rxlength = this->write_only_ ? 0 : partial * 8;
+      desc->tx_buffer = ptr;
+      esp_err_t const err = spi_device_queue_trans(this->handle_, desc, portMAX_DELAY);
+      if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Queue transmit failed - err %X", err);
+        return;
+      }
+      this->async_next_ = (this->async_next_ + 1) % ASYNC_QUEUE_SIZE;
+      this->async_pending_++;
+      length -= partial;
+      ptr += partial;
+    }
+  }
+
+  void wait_write_complete(size_t pending) override {
+    while (this->async_pending_ > pending) {
+      spi_transaction_t *desc;
+      esp_err_t const err = spi_device_get_trans_result(this->handle_, &desc, portMAX_DELAY);
+      if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Transmit failed - err %X", err);
+        this->async_pending_ = 0;  // nothing left to collect
+        return;
+      }
+      this->async_pending_--;
+    }
+  }
+
  protected:
   SPIInterface channel_{};
   spi_device_handle_t handle_{};
   bool write_only_{false};
+  spi_transaction_t async_desc_[ASYNC_QUEUE_SIZE]{};
+  size_t async_next_{0};     // index of the descriptor used by the next queued transfer
+  size_t async_pending_{0};  // number of queued transfers not yet collected
 };
 
 class SPIBusHw : public SPIBus {
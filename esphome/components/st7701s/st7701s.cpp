@@ -85,6 +85,15 @@ void ST7701S::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
     esph_log_e(TAG, "lcd_lcd_panel_draw_bitmap failed: %s", esp_err_to_name(err));
 }
 
+void ST7701S::draw_pixel_row_at(int x_start, int y, int w, const uint8_t *ptr, display::ColorOrder order,
+                                display::ColorBitness bitness, bool big_endian) {
+  // without rotation the row can go straight to the panel
+  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES) {
+    return display::Display::draw_pixel_row_at(x_start, y, w, ptr, order, bitness, big_endian);
+  }
+  this->draw_pixels_at(x_start, y, w, 1, ptr, order, bitness, big_endian, 0, 0, 0);
+}
+
 void ST7701S::draw_pixel_at(int x, int y, Color color) {
   if (!this->get_clipping().inside(x, y))
     return;  // NOLINT
@@ -172,7 +172,9 @@ void ST7789V::write_display_data() {
   this->dc_pin_->digital_write(true);
 
   if (this->eightbitcolor_) {
-    uint8_t temp_buffer[TEMP_BUFFER_SIZE];
+    // double buffered: one buffer is converted while the other one is being sent
+    uint8_t temp_buffers[2][TEMP_BUFFER_SIZE];
+    uint8_t *temp_buffer = temp_buffers[0];
     size_t temp_index = 0;
     for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
       for (int index = 0; index < this->get_width_internal(); ++index) {
@@ -182,7 +184,9 @@ void ST7789V::write_display_data() {
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
         if (temp_index == TEMP_BUFFER_SIZE) {
-          this->write_array(temp_buffer, TEMP_BUFFER_SIZE);
+          this->write_array_async(temp_buffer, TEMP_BUFFER_SIZE);
+          temp_buffer = temp_buffer == temp_buffers[0] ? temp_buffers[1] : temp_buffers[0];
+          this->wait_write_complete(1);
           temp_index = 0;
         }
       }
@@ -13,16 +13,30 @@ AUTO_LOAD = ["socket"]
 CODEOWNERS = ["@Links2004"]
 DEPENDENCIES = ["network"]
 
+CONF_AGGREGATION = "aggregation"
 CONF_HOST = "host"
+CONF_MTU = "mtu"
 CONF_PREFIX = "prefix"
 
 statsd_component_ns = cg.esphome_ns.namespace("statsd")
 StatsdComponent = statsd_component_ns.class_("StatsdComponent", cg.PollingComponent)
+StatsdAggregation = statsd_component_ns.enum("StatsdAggregation")
+
+AGGREGATIONS = {
+    "last": StatsdAggregation.AGGREGATION_LAST,
+    "mean": StatsdAggregation.AGGREGATION_MEAN,
+    "min": StatsdAggregation.AGGREGATION_MIN,
+    "max": StatsdAggregation.AGGREGATION_MAX,
+    "count": StatsdAggregation.AGGREGATION_COUNT,
+}
 
 CONFIG_SENSORS_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_ID): cv.use_id(sensor.Sensor),
         cv.Required(CONF_NAME): cv.string_strict,
+        cv.Optional(CONF_AGGREGATION, default="last"): cv.enum(
+            AGGREGATIONS, lower=True
+        ),
     }
 )
 
@@ -39,6 +53,7 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Required(CONF_HOST): cv.string_strict,
         cv.Optional(CONF_PORT, default=8125): cv.port,
         cv.Optional(CONF_PREFIX, default=""): cv.string_strict,
+        cv.Optional(CONF_MTU, default=1024): cv.int_range(min=128, max=65507),
         cv.Optional(CONF_SENSORS): cv.ensure_list(CONFIG_SENSORS_SCHEMA),
         cv.Optional(CONF_BINARY_SENSORS): cv.ensure_list(CONFIG_BINARY_SENSORS_SCHEMA),
     }
@@ -55,10 +70,13 @@ async def to_code(config):
             config.get(CONF_PREFIX),
         )
     )
+    cg.add(var.set_mtu(config[CONF_MTU]))
 
     for sensor_cfg in config.get(CONF_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
-        cg.add(var.register_sensor(sensor_cfg[CONF_NAME], s))
+        cg.add(
+            var.register_sensor(sensor_cfg[CONF_NAME], s, sensor_cfg[CONF_AGGREGATION])
+        )
 
     for sensor_cfg in config.get(CONF_BINARY_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
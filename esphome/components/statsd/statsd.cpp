@@ -2,16 +2,18 @@
 
 #include "statsd.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace esphome {
 namespace statsd {
 
-// send UDP packet if we reach 1Kb packed size
-// this is needed since statsD does not support fragmented UDP packets
-static const uint16_t SEND_THRESHOLD = 1024;
-
 static const char *const TAG = "statsD";
 
 void StatsdComponent::setup() {
+  // statsD does not support fragmented UDP packets, so datagrams are never packed beyond the MTU
+  this->buffer_ = std::unique_ptr<char[]>(new char[this->mtu_ + 1]);  // + 1 for snprintf's terminator
+
 #ifndef USE_ESP8266
   this->sock_ = esphome::socket::socket(AF_INET, SOCK_DGRAM, 0);
 
@@ -40,6 +42,7 @@ void StatsdComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "statsD:");
   ESP_LOGCONFIG(TAG, "  host: %s", this->host_);
   ESP_LOGCONFIG(TAG, "  port: %d", this->port_);
+  ESP_LOGCONFIG(TAG, "  mtu: %u", this->mtu_);
   if (this->prefix_) {
     ESP_LOGCONFIG(TAG, "  prefix: %s", this->prefix_);
   }
@@ -48,24 +51,45 @@ void StatsdComponent::dump_config() {
   for (sensors_t s : this->sensors_) {
     ESP_LOGCONFIG(TAG, "    - name: %s", s.name);
     ESP_LOGCONFIG(TAG, "      type: %d", s.type);
+    ESP_LOGCONFIG(TAG, "      aggregation: %d", s.aggregation);
   }
 }
 
 float StatsdComponent::get_setup_priority() const { return esphome::setup_priority::AFTER_WIFI; }
 
 #ifdef USE_SENSOR
-void StatsdComponent::register_sensor(const char *name, esphome::sensor::Sensor *sensor) {
-  sensors_t s;
+void StatsdComponent::register_sensor(const char *name, esphome::sensor::Sensor *sensor,
+                                      StatsdAggregation aggregation) {
+  sensors_t s{};
   s.name = name;
   s.sensor = sensor;
   s.type = TYPE_SENSOR;
+  s.aggregation = aggregation;
   this->sensors_.push_back(s);
+
+  if (aggregation == AGGREGATION_LAST)
+    return;
+  size_t index = this->sensors_.size() - 1;
+  sensor->add_on_state_callback([this, index](float state) {
+    if (std::isnan(state))
+      return;
+    sensors_t &s = this->sensors_[index];
+    if (s.count == 0) {
+      s.min = state;
+      s.max = state;
+    } else {
+      s.min = std::min(s.min, state);
+      s.max = std::max(s.max, state);
+    }
+    s.sum += state;
+    s.count++;
+  });
 }
 #endif
 
 #ifdef USE_BINARY_SENSOR
 void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_sensor::BinarySensor *binary_sensor) {
-  sensors_t s;
+  sensors_t s{};
   s.name = name;
   s.binary_sensor = binary_sensor;
   s.type = TYPE_BINARY_SENSOR;
@@ -74,61 +98,112 @@ void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_s
 #endif
 
 void StatsdComponent::update() {
-  std::string out;
-  out.reserve(SEND_THRESHOLD);
-
-  for (sensors_t s : this->sensors_) {
+  for (sensors_t &s : this->sensors_) {
     double val = 0;
-    switch (s.type) {
+    if (!this->take_value_(s, val))
+      continue;
+
+    // statsD metric types:
+    // https://github.com/statsd/statsd/blob/master/docs/metric_types.md
+    if (s.type == TYPE_SENSOR && s.aggregation == AGGREGATION_COUNT) {
+      this->add_metric_(s.name, val, "c");
+    } else {
+      this->add_metric_(s.name, val, "g");
+    }
+  }
+
+  this->flush_();
+}
+
+bool StatsdComponent::take_value_(sensors_t &s, double &val) {
+  switch (s.type) {
 #ifdef USE_SENSOR
-      case TYPE_SENSOR:
+    case TYPE_SENSOR: {
+      if (s.aggregation == AGGREGATION_LAST) {
         if (!s.sensor->has_state()) {
-          continue;
+          return false;
         }
         val = s.sensor->state;
-        break;
+        return true;
+      }
+      uint32_t count = s.count;
+      float sum = s.sum;
+      s.count = 0;
+      s.sum = 0;
+      if (count == 0) {
+        return false;
+      }
+      switch (s.aggregation) {
+        case AGGREGATION_MEAN:
+          val = sum / count;
+          break;
+        case AGGREGATION_MIN:
+          val = s.min;
+          break;
+        case AGGREGATION_MAX:
+          val = s.max;
+          break;
+        default:
+          val = count;
+          break;
+      }
+      return true;
+    }
 #endif
 #ifdef USE_BINARY_SENSOR
-      case TYPE_BINARY_SENSOR:
-        if (!s.binary_sensor->has_state()) {
-          continue;
-        }
-        // map bool to double
-        if (s.binary_sensor->state) {
-          val = 1;
-        }
-        break;
+    case TYPE_BINARY_SENSOR:
+      if (!s.binary_sensor->has_state()) {
+        return false;
+      }
+      // map bool to double
+      val = s.binary_sensor->state ? 1 : 0;
+      return true;
 #endif
-      default:
-        ESP_LOGE(TAG, "type not known, name: %s type: %d", s.name, s.type);
-        continue;
-    }
+    default:
+      ESP_LOGE(TAG, "type not known, name: %s type: %d", s.name, s.type);
+      return false;
+  }
+}
 
-    // statsD gauge:
-    // https://github.com/statsd/statsd/blob/master/docs/metric_types.md
-    // This implies you can't explicitly set a gauge to a negative number without first setting it to zero.
-    if (val < 0) {
-      if (this->prefix_) {
-        out.append(str_sprintf("%s.", this->prefix_));
-      }
-      out.append(str_sprintf("%s:0|g\n", s.name));
+void StatsdComponent::add_metric_(const char *name, double val, const char *type) {
+  const char *prefix = this->prefix_ != nullptr ? this->prefix_ : "";
+  const char *separator = prefix[0] != '\0' ? "." : "";
+
+  // Try the current datagram first, then an empty one
+  for (uint8_t attempt = 0; attempt < 2; attempt++) {
+    char *out = this->buffer_.get() + this->buffer_len_;
+    size_t remaining = this->mtu_ + 1 - this->buffer_len_;
+    int len;
+    if (type[0] == 'c') {
+      len = snprintf(out, remaining, "%s%s%s:%.0f|c\n", prefix, separator, name, val);
+    } else if (val < 0) {
+      // This implies you can't explicitly set a gauge to a negative number without first setting it to zero.
+      // Both lines are added at once so they always end up in the same datagram, in order.
+      len = snprintf(out, remaining, "%s%s%s:0|g\n%s%s%s:%f|g\n", prefix, separator, name, prefix, separator, name,
+                     val);
+    } else {
+      len = snprintf(out, remaining, "%s%s%s:%f|g\n", prefix, separator, name, val);
     }
-    if (this->prefix_) {
-      out.append(str_sprintf("%s.", this->prefix_));
+    if (len >= 0 && static_cast<size_t>(len) < remaining) {
+      this->buffer_len_ += len;
+      return;
     }
-    out.append(str_sprintf("%s:%f|g\n", s.name, val));
-
-    if (out.length() > SEND_THRESHOLD) {
-      this->send_(&out);
-      out.clear();
+    if (this->buffer_len_ == 0) {
+      break;
     }
+    this->flush_();
   }
+  this->buffer_len_ = 0;
+  ESP_LOGW(TAG, "Metric %s is larger than the MTU of %u bytes", name, this->mtu_);
+}
 
-  this->send_(&out);
+void StatsdComponent::flush_() {
+  this->send_(this->buffer_.get(), this->buffer_len_);
+  this->buffer_len_ = 0;
 }
 
-void StatsdComponent::send_(std::string *out) {
-  if (out->empty()) {
+void StatsdComponent::send_(const char *data, size_t len) {
+  if (len == 0) {
     return;
   }
 #ifdef USE_ESP8266
@@ -136,7 +211,7 @@ void StatsdComponent::send_(std::string *out) {
   ip.fromString(this->host_);
 
   this->sock_.beginPacket(ip, this->port_);
-  this->sock_.write((const uint8_t *) out->c_str(), out->length());
+  this->sock_.write((const uint8_t *) data, len);
   this->sock_.endPacket();
 
 #else
@@ -144,10 +219,10 @@ void StatsdComponent::send_(std::string *out) {
     return;
   }
 
-  int n_bytes = this->sock_->sendto(out->c_str(), out->length(), 0, reinterpret_cast<sockaddr *>(&this->destination_),
-                                    sizeof(this->destination_));
-  if (n_bytes != out->length()) {
-    ESP_LOGE(TAG, "Failed to send UDP packed (%d of %d)", n_bytes, out->length());
+  int n_bytes =
+      this->sock_->sendto(data, len, 0, reinterpret_cast<sockaddr *>(&this->destination_), sizeof(this->destination_));
+  if (n_bytes != len) {
+    ESP_LOGE(TAG, "Failed to send UDP packed (%d of %d)", n_bytes, len);
   }
 #endif
 }
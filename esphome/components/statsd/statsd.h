@@ -29,9 +29,23 @@ namespace statsd {
 
 using sensor_type_t = enum { TYPE_SENSOR, TYPE_BINARY_SENSOR };
 
+/// How the samples of a sensor between two flushes are combined into the value sent.
+enum StatsdAggregation : uint8_t {
+  AGGREGATION_LAST,   ///< Gauge with the state at flush time.
+  AGGREGATION_MEAN,   ///< Gauge with the mean of the samples.
+  AGGREGATION_MIN,    ///< Gauge with the lowest sample.
+  AGGREGATION_MAX,    ///< Gauge with the highest sample.
+  AGGREGATION_COUNT,  ///< Counter with the number of samples.
+};
+
 using sensors_t = struct {
   const char *name;
   sensor_type_t type;
+  StatsdAggregation aggregation;
+  uint32_t count;
+  float sum;
+  float min;
+  float max;
   union {
 #ifdef USE_SENSOR
     esphome::sensor::Sensor *sensor;
@@ -56,9 +70,12 @@ class StatsdComponent : public PollingComponent {
     this->port_ = port;
     this->prefix_ = prefix;
   }
+  /// Set the maximum size of a datagram, metrics are packed into as few datagrams as possible.
+  void set_mtu(uint16_t mtu) { this->mtu_ = mtu; }
 
 #ifdef USE_SENSOR
-  void register_sensor(const char *name, esphome::sensor::Sensor *sensor);
+  void register_sensor(const char *name, esphome::sensor::Sensor *sensor,
+                       StatsdAggregation aggregation = AGGREGATION_LAST);
 #endif
 
 #ifdef USE_BINARY_SENSOR
@@ -69,6 +86,11 @@ class StatsdComponent : public PollingComponent {
   const char *host_;
   const char *prefix_;
   uint16_t port_;
+  uint16_t mtu_{1024};
+
+  /// Datagram being packed, allocated once in setup().
+  std::unique_ptr<char[]> buffer_;
+  size_t buffer_len_{0};
 
   std::vector<sensors_t> sensors_;
 
@@ -79,7 +101,12 @@ class StatsdComponent : public PollingComponent {
   struct sockaddr_in destination_;
 #endif
 
-  void send_(std::string *out);
+  /// Get the value to send for s and reset its aggregation, false if there is nothing to send.
+  bool take_value_(sensors_t &s, double &val);
+  /// Append a metric to the datagram, sending it first when the metric doesn't fit anymore.
+  void add_metric_(const char *name, double val, const char *type);
+  void flush_();
+  void send_(const char *data, size_t len);
 };
 
 }  // namespace statsd
@@ -7,6 +7,8 @@ namespace tca9548a {
 static const char *const TAG = "tca9548a";
 
 i2c::ErrorCode TCA9548AChannel::readv(uint8_t address, i2c::ReadBuffer *buffers, size_t cnt) {
+  if (this->in_batch_)
+    return this->parent_->bus_->readv(address, buffers, cnt);
   auto err = this->parent_->switch_to_channel(channel_);
   if (err != i2c::ERROR_OK)
     return err;
@@ -15,6 +17,8 @@ i2c::ErrorCode TCA9548AChannel::readv(uint8_t address, i2c::ReadBuffer *buffers,
   return err;
 }
 i2c::ErrorCode TCA9548AChannel::writev(uint8_t address, i2c::WriteBuffer *buffers, size_t cnt, bool stop) {
+  if (this->in_batch_)
+    return this->parent_->bus_->writev(address, buffers, cnt, stop);
   auto err = this->parent_->switch_to_channel(channel_);
   if (err != i2c::ERROR_OK)
     return err;
@@ -23,6 +27,24 @@ i2c::ErrorCode TCA9548AChannel::writev(uint8_t address, i2c::WriteBuffer *buffer
   return err;
 }
 
+void TCA9548AChannel::submit(i2c::I2CTransaction &&transaction) {
+  // queued transactions are executed by the root bus, grouped by channel
+  if (transaction.bus == nullptr)
+    transaction.bus = this;
+  this->parent_->bus_->submit(std::move(transaction));
+}
+i2c::ErrorCode TCA9548AChannel::begin_batch() {
+  auto err = this->parent_->switch_to_channel(channel_);
+  this->in_batch_ = err == i2c::ERROR_OK;
+  return err;
+}
+void TCA9548AChannel::end_batch() {
+  if (!this->in_batch_)
+    return;
+  this->in_batch_ = false;
+  this->parent_->disable_all_channels();
+}
+
 void TCA9548AComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up TCA9548A...");
   uint8_t status = 0;
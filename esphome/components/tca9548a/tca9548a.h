@@ -17,9 +17,14 @@ class TCA9548AChannel : public i2c::I2CBus {
   i2c::ErrorCode readv(uint8_t address, i2c::ReadBuffer *buffers, size_t cnt) override;
   i2c::ErrorCode writev(uint8_t address, i2c::WriteBuffer *buffers, size_t cnt, bool stop) override;
 
+  void submit(i2c::I2CTransaction &&transaction) override;
+  i2c::ErrorCode begin_batch() override;
+  void end_batch() override;
+
  protected:
   uint8_t channel_;
   TCA9548AComponent *parent_;
+  bool in_batch_{false};
 };
 
 class TCA9548AComponent : public Component, public i2c::I2CDevice {
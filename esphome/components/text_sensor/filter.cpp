@@ -9,19 +9,19 @@ namespace text_sensor {
 static const char *const TAG = "text_sensor.filter";
 
 // Filter
-void Filter::input(const std::string &value) {
+void Filter::input(std::string value) {
   ESP_LOGVV(TAG, "Filter(%p)::input(%s)", this, value.c_str());
-  optional<std::string> out = this->new_value(value);
+  optional<std::string> out = this->new_value(std::move(value));
   if (out.has_value())
-    this->output(*out);
+    this->output(std::move(*out));
 }
-void Filter::output(const std::string &value) {
+void Filter::output(std::string value) {
   if (this->next_ == nullptr) {
     ESP_LOGVV(TAG, "Filter(%p)::output(%s) -> SENSOR", this, value.c_str());
-    this->parent_->internal_send_state_to_frontend(value);
+    this->parent_->internal_send_state_to_frontend(std::move(value));
   } else {
     ESP_LOGVV(TAG, "Filter(%p)::output(%s) -> %p", this, value.c_str(), this->next_);
-    this->next_->input(value);
+    this->next_->input(std::move(value));
   }
 }
 void Filter::initialize(TextSensor *parent, Filter *next) {
@@ -36,8 +36,9 @@ const lambda_filter_t &LambdaFilter::get_lambda_filter() const { return this->la
 void LambdaFilter::set_lambda_filter(const lambda_filter_t &lambda_filter) { this->lambda_filter_ = lambda_filter; }
 
 optional<std::string> LambdaFilter::new_value(std::string value) {
-  auto it = this->lambda_filter_(value);
-  ESP_LOGVV(TAG, "LambdaFilter(%p)::new_value(%s) -> %s", this, value.c_str(), it.value_or("").c_str());
+  ESP_LOGVV(TAG, "LambdaFilter(%p)::new_value(%s)", this, value.c_str());
+  auto it = this->lambda_filter_(std::move(value));
+  ESP_LOGVV(TAG, "LambdaFilter(%p)::new_value -> %s", this, it.value_or("").c_str());
   return it;
 }
 
@@ -56,10 +57,16 @@ optional<std::string> ToLowerFilter::new_value(std::string value) {
 }
 
 // Append
-optional<std::string> AppendFilter::new_value(std::string value) { return value + this->suffix_; }
+optional<std::string> AppendFilter::new_value(std::string value) {
+  value.append(this->suffix_);
+  return value;
+}
 
 // Prepend
-optional<std::string> PrependFilter::new_value(std::string value) { return this->prefix_ + value; }
+optional<std::string> PrependFilter::new_value(std::string value) {
+  value.insert(0, this->prefix_);
+  return value;
+}
 
 // Substitute
 optional<std::string> SubstituteFilter::new_value(std::string value) {
@@ -74,7 +81,9 @@ optional<std::string> SubstituteFilter::new_value(std::string value) {
 // Map
 optional<std::string> MapFilter::new_value(std::string value) {
   auto item = mappings_.find(value);
-  return item == mappings_.end() ? value : item->second;
+  if (item != mappings_.end())
+    value.assign(item->second);  // into the existing buffer, the mapped values are usually short
+  return value;
 }
 
 }  // namespace text_sensor
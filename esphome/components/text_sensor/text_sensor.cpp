@@ -15,7 +15,8 @@ void TextSensor::publish_state(const std::string &state) {
   if (this->filter_list_ == nullptr) {
     this->internal_send_state_to_frontend(state);
   } else {
-    this->filter_list_->input(state);
+    this->filter_buffer_ = state;
+    this->filter_list_->input(std::move(this->filter_buffer_));
   }
 }
 
@@ -49,10 +50,10 @@ void TextSensor::clear_filters() {
   this->filter_list_ = nullptr;
 }
 
-void TextSensor::add_on_state_callback(std::function<void(std::string)> callback) {
+void TextSensor::add_on_state_callback(std::function<void(const std::string &)> callback) {
   this->callback_.add(std::move(callback));
 }
-void TextSensor::add_on_raw_state_callback(std::function<void(std::string)> callback) {
+void TextSensor::add_on_raw_state_callback(std::function<void(const std::string &)> callback) {
   this->raw_callback_.add(std::move(callback));
 }
 
@@ -60,9 +61,17 @@ std::string TextSensor::get_state() const { return this->state; }
 std::string TextSensor::get_raw_state() const { return this->raw_state; }
 void TextSensor::internal_send_state_to_frontend(const std::string &state) {
   this->state = state;
+  this->notify_frontend_();
+}
+void TextSensor::internal_send_state_to_frontend(std::string &&state) {
+  this->state.swap(state);
+  this->filter_buffer_.swap(state);
+  this->notify_frontend_();
+}
+void TextSensor::notify_frontend_() {
   this->has_state_ = true;
-  ESP_LOGD(TAG, "'%s': Sending state '%s'", this->name_.c_str(), state.c_str());
-  this->callback_.call(state);
+  ESP_LOGD(TAG, "'%s': Sending state '%s'", this->name_.c_str(), this->state.c_str());
+  this->callback_.call(this->state);
 }
 
 std::string TextSensor::unique_id() { return ""; }
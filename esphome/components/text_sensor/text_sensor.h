@@ -52,9 +52,9 @@ class TextSensor : public EntityBase, public EntityBase_DeviceClass {
   /// Clear the entire filter chain.
   void clear_filters();
 
-  void add_on_state_callback(std::function<void(std::string)> callback);
+  void add_on_state_callback(std::function<void(const std::string &)> callback);
   /// Add a callback that will be called every time the sensor sends a raw value.
-  void add_on_raw_state_callback(std::function<void(std::string)> callback);
+  void add_on_raw_state_callback(std::function<void(const std::string &)> callback);
 
   std::string state;
   std::string raw_state;
@@ -70,12 +70,18 @@ class TextSensor : public EntityBase, public EntityBase_DeviceClass {
   bool has_state();
 
   void internal_send_state_to_frontend(const std::string &state);
+  /// Take over the buffer of a filtered state, keeping the one of the previous state for the next filter run.
+  void internal_send_state_to_frontend(std::string &&state);
 
  protected:
-  CallbackManager<void(std::string)> raw_callback_;  ///< Storage for raw state callbacks.
-  CallbackManager<void(std::string)> callback_;      ///< Storage for filtered state callbacks.
+  void notify_frontend_();
+
+  CallbackManager<void(const std::string &)> raw_callback_;  ///< Storage for raw state callbacks.
+  CallbackManager<void(const std::string &)> callback_;      ///< Storage for filtered state callbacks.
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
+  /// The string the filters work on; recycled from earlier states so steady updates don't allocate.
+  std::string filter_buffer_;
 
   bool has_state_{false};
 };
@@ -7,7 +7,17 @@ namespace touchscreen {
 
 static const char *const TAG = "touchscreen";
 
-void TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) { store->touched = true; }
+void IRAM_ATTR TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) {
+  // Controllers report the position at the interrupt, however late the main loop gets to read it
+  if (!store->touched)
+    store->touch_time = micros();
+  store->touched = true;
+}
+
+void Touchscreen::request_touches_() {
+  this->store_.touch_time = micros();
+  this->store_.touched = true;
+}
 
 void Touchscreen::attach_interrupt_(InternalGPIOPin *irq_pin, esphome::gpio::InterruptType type) {
   irq_pin->attach_interrupt(TouchscreenInterrupt::gpio_intr, &this->store_, type);
@@ -26,7 +36,7 @@ void Touchscreen::call_setup() {
 
 void Touchscreen::update() {
   if (!this->store_.init) {
-    this->store_.touched = true;
+    this->request_touches_();
   } else {
     // no need to poll if we have interrupts.
     ESP_LOGW(TAG, "Touch Polling Stopped. You can safely remove the 'update_interval:' variable from the YAML file.");
@@ -37,6 +47,7 @@ void Touchscreen::update() {
 void Touchscreen::loop() {
   if (this->store_.touched) {
     ESP_LOGVV(TAG, "<< Do Touch loop >>");
+    this->sample_time_ = this->store_.touch_time;
     this->first_touch_ = this->touches_.empty();
     this->need_update_ = false;
     this->is_touched_ = false;
@@ -57,12 +68,13 @@ void Touchscreen::loop() {
       }
     } else {
       this->store_.touched = false;
-      this->defer([this]() { this->send_touches_(); });
+      // Sent right away rather than deferred to the next loop, to keep the latency down
+      this->send_touches_();
       if (this->touch_timeout_ > 0) {
         // Simulate a touch after <this->touch_timeout_> ms. This will reset any existing timeout operation.
         // This is to detect touch release.
         if (this->is_touched_) {
-          this->set_timeout(TAG, this->touch_timeout_, [this]() { this->store_.touched = true; });
+          this->set_timeout(TAG, this->touch_timeout_, [this]() { this->request_touches_(); });
         } else {
           this->cancel_timeout(TAG);
         }
@@ -74,7 +86,8 @@ void Touchscreen::loop() {
 void Touchscreen::add_raw_touch_position_(uint8_t id, int16_t x_raw, int16_t y_raw, int16_t z_raw) {
   TouchPoint tp;
   uint16_t x, y;
-  if (this->touches_.count(id) == 0) {
+  bool is_new = this->touches_.count(id) == 0;
+  if (is_new) {
     tp.state = STATE_PRESSED;
     tp.id = id;
   } else {
@@ -104,6 +117,19 @@ void Touchscreen::add_raw_touch_position_(uint8_t id, int16_t x_raw, int16_t y_r
     tp.y_org = tp.y;
   }
 
+  // Velocity from the positions and their sample times, averaged with the previous one since
+  // controllers report positions in steps of a few pixels.
+  if (!is_new && !(tp.state & STATE_CALIBRATE)) {
+    uint32_t dt = this->sample_time_ - tp.timestamp;
+    if (dt > 0) {
+      float vx = ((int) tp.x - (int) tp.x_prev) * 1e6f / dt;
+      float vy = ((int) tp.y - (int) tp.y_prev) * 1e6f / dt;
+      tp.vx = (tp.vx + vx) / 2;
+      tp.vy = (tp.vy + vy) / 2;
+    }
+  }
+  tp.timestamp = this->sample_time_;
+
   this->touches_[id] = tp;
 
   this->is_touched_ = true;
@@ -113,9 +139,10 @@ void Touchscreen::add_raw_touch_position_(uint8_t id, int16_t x_raw, int16_t y_r
 }
 
 void Touchscreen::send_touches_() {
-  TouchPoints_t touches;
+  TouchPoints_t &touches = this->touch_points_;
+  touches.clear();
   ESP_LOGV(TAG, "Touch status: is_touched=%d, was_touched=%d", this->is_touched_, this->was_touched_);
-  for (auto tp : this->touches_) {
+  for (auto &tp : this->touches_) {
     ESP_LOGV(TAG, "Touch status: %d/%d: raw:(%4d,%4d,%4d) calc:(%3d,%4d)", tp.second.id, tp.second.state,
              tp.second.x_raw, tp.second.y_raw, tp.second.z_raw, tp.second.x, tp.second.y);
     touches.push_back(tp.second);
@@ -25,12 +25,18 @@ struct TouchPoint {
   uint16_t x_org{0}, y_org{0};
   uint16_t x{0}, y{0};
   int8_t state{0};
+  /// micros() when the position was sampled; the time of the interrupt for controllers with an interrupt pin.
+  uint32_t timestamp{0};
+  /// Smoothed velocity in pixels per second, 0 for a new touch.
+  float vx{0}, vy{0};
 };
 
 using TouchPoints_t = std::vector<TouchPoint>;
 
 struct TouchscreenInterrupt {
   volatile bool touched{true};
+  /// micros() of the first interrupt since the touches were last read.
+  volatile uint32_t touch_time{0};
   bool init{false};
   static void gpio_intr(TouchscreenInterrupt *store);
 };
@@ -93,6 +99,8 @@ class Touchscreen : public PollingComponent {
   virtual void update_touches() = 0;
 
   void send_touches_();
+  /// Request a read of the touches, at the current time.
+  void request_touches_();
 
   int16_t normalize_(int16_t val, int16_t min_val, int16_t max_val, bool inverted = false);
 
@@ -110,7 +118,11 @@ class Touchscreen : public PollingComponent {
   std::vector<TouchListener *> touch_listeners_;
 
   std::map<uint8_t, TouchPoint> touches_;
+  /// Touches handed to the triggers and listeners, reused so updates don't allocate.
+  TouchPoints_t touch_points_;
   TouchscreenInterrupt store_;
+  /// When the touches being read were sampled.
+  uint32_t sample_time_{0};
 
   bool first_touch_{true};
   bool need_update_{false};
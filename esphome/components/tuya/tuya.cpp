@@ -29,10 +29,12 @@ void Tuya::setup() {
 }
 
 void Tuya::loop() {
-  while (this->available()) {
-    uint8_t c;
-    this->read_byte(&c);
-    this->handle_char_(c);
+  const uint8_t *data;
+  size_t len;
+  while ((len = this->peek_rx(&data)) > 0) {
+    for (size_t i = 0; i < len; i++)
+      this->handle_char_(data[i]);
+    this->consume_rx(len);
   }
   process_command_queue_();
 }
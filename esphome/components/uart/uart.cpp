@@ -10,6 +10,44 @@ namespace uart {
 
 static const char *const TAG = "uart";
 
+bool UARTDevice::read_array(uint8_t *data, size_t len) {
+  size_t staged = std::min(len, this->rx_tail_ - this->rx_head_);
+  if (staged == 0)
+    return this->parent_->read_array(data, len);
+  memcpy(data, &this->rx_staging_[this->rx_head_], staged);
+  // the staged bytes stay available for a retry if the rest can't be read
+  if (staged < len && !this->parent_->read_array(data + staged, len - staged))
+    return false;
+  this->consume_rx(staged);
+  return true;
+}
+
+size_t UARTDevice::peek_rx(const uint8_t **data) {
+  if (this->rx_staging_.empty())
+    this->rx_staging_.resize(this->rx_chunk_size_);
+
+  size_t staged = this->rx_tail_ - this->rx_head_;
+  if (this->rx_head_ > 0) {
+    // keep unconsumed bytes at the front so the caller always gets a single contiguous span
+    memmove(this->rx_staging_.data(), &this->rx_staging_[this->rx_head_], staged);
+    this->rx_head_ = 0;
+    this->rx_tail_ = staged;
+  }
+
+  size_t space = this->rx_staging_.size() - this->rx_tail_;
+  if (space > 0) {
+    int available = this->parent_->available();
+    if (available > 0) {
+      size_t len = std::min(space, size_t(available));
+      if (this->parent_->read_array(&this->rx_staging_[this->rx_tail_], len))
+        this->rx_tail_ += len;
+    }
+  }
+
+  *data = this->rx_staging_.data() + this->rx_head_;
+  return this->rx_tail_ - this->rx_head_;
+}
+
 void UARTDevice::check_uart_settings(uint32_t baud_rate, uint8_t stop_bits, UARTParityOptions parity,
                                      uint8_t data_bits) {
   if (this->parent_->get_baud_rate() != baud_rate) {
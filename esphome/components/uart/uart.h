@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
@@ -26,10 +28,23 @@ class UARTDevice {
 
   void write_str(const char *str) { this->parent_->write_str(str); }
 
-  bool read_byte(uint8_t *data) { return this->parent_->read_byte(data); }
-  bool peek_byte(uint8_t *data) { return this->parent_->peek_byte(data); }
+  bool read_byte(uint8_t *data) {
+    if (this->rx_head_ != this->rx_tail_) {
+      *data = this->rx_staging_[this->rx_head_];
+      this->consume_rx(1);
+      return true;
+    }
+    return this->parent_->read_byte(data);
+  }
+  bool peek_byte(uint8_t *data) {
+    if (this->rx_head_ != this->rx_tail_) {
+      *data = this->rx_staging_[this->rx_head_];
+      return true;
+    }
+    return this->parent_->peek_byte(data);
+  }
 
-  bool read_array(uint8_t *data, size_t len) { return this->parent_->read_array(data, len); }
+  bool read_array(uint8_t *data, size_t len);
   template<size_t N> optional<std::array<uint8_t, N>> read_array() {  // NOLINT
     std::array<uint8_t, N> res;
     if (!this->read_array(res.data(), N)) {
@@ -38,7 +53,29 @@ class UARTDevice {
     return res;
   }
 
-  int available() { return this->parent_->available(); }
+  int available() { return int(this->rx_tail_ - this->rx_head_) + this->parent_->available(); }
+
+  /** Get a view of the received bytes without consuming them.
+   *
+   * Bytes waiting in the UART driver are moved into a per-device staging buffer with a single bulk read, so
+   * protocol parsers can walk whole chunks instead of calling available() and read_byte() for every byte.
+   * Bytes that are not passed to consume_rx() are returned again on the next call. The other read methods
+   * drain the staging buffer first, so both styles can be mixed.
+   *
+   * @param data Set to the first unconsumed byte.
+   * @return Number of contiguous bytes available at *data, 0 if nothing has been received.
+   */
+  size_t peek_rx(const uint8_t **data);
+
+  /// Drop the first len bytes returned by peek_rx().
+  void consume_rx(size_t len) {
+    this->rx_head_ += std::min(len, this->rx_tail_ - this->rx_head_);
+    if (this->rx_head_ == this->rx_tail_)
+      this->rx_head_ = this->rx_tail_ = 0;
+  }
+
+  /// Set the size of the staging buffer used by peek_rx(). It is allocated on first use.
+  void set_rx_chunk_size(size_t rx_chunk_size) { this->rx_chunk_size_ = rx_chunk_size; }
 
   void flush() { return this->parent_->flush(); }
 
@@ -66,6 +103,11 @@ class UARTDevice {
 
  protected:
   UARTComponent *parent_{nullptr};
+
+  std::vector<uint8_t> rx_staging_;
+  size_t rx_chunk_size_{128};
+  size_t rx_head_{0};
+  size_t rx_tail_{0};
 };
 
 }  // namespace uart
@@ -0,0 +1,136 @@
+#include "sample_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace voltage_sampler {
+
+void SampleStats::reset() {
+  this->count_ = 0;
+  this->offset_ = 0.0f;
+  this->sum_ = 0.0;
+  this->squared_sum_ = 0.0;
+  this->min_ = 0.0f;
+  this->max_ = 0.0f;
+}
+
+void SampleStats::add(const float *samples, size_t count) {
+  if (count == 0)
+    return;
+  if (this->count_ == 0) {
+    this->offset_ = samples[0];
+    this->min_ = samples[0];
+    this->max_ = samples[0];
+  }
+
+  // four independent sums, so each addition doesn't have to wait for the previous one
+  const float offset = this->offset_;
+  float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float squared_sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float min = this->min_;
+  float max = this->max_;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    for (size_t j = 0; j < 4; j++) {
+      const float value = samples[i + j];
+      const float delta = value - offset;
+      sum[j] += delta;
+      squared_sum[j] += delta * delta;
+      min = std::min(min, value);
+      max = std::max(max, value);
+    }
+  }
+  for (; i < count; i++) {
+    const float value = samples[i];
+    const float delta = value - offset;
+    sum[0] += delta;
+    squared_sum[0] += delta * delta;
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+
+  this->sum_ += (sum[0] + sum[1]) + (sum[2] + sum[3]);
+  this->squared_sum_ += (squared_sum[0] + squared_sum[1]) + (squared_sum[2] + squared_sum[3]);
+  this->min_ = min;
+  this->max_ = max;
+  this->count_ += count;
+}
+
+float SampleStats::get_mean() const {
+  if (this->count_ == 0)
+    return NAN;
+  return this->offset_ + this->sum_ / this->count_;
+}
+
+float SampleStats::get_rms() const {
+  if (this->count_ == 0)
+    return NAN;
+  const double mean = this->offset_ + this->sum_ / this->count_;
+  const double ac_rms = this->get_ac_rms();
+  return std::sqrt(mean * mean + ac_rms * ac_rms);
+}
+
+float SampleStats::get_ac_rms() const {
+  if (this->count_ == 0)
+    return NAN;
+  const double mean_delta = this->sum_ / this->count_;
+  const double variance = this->squared_sum_ / this->count_ - mean_delta * mean_delta;
+  return variance > 0 ? std::sqrt(variance) : 0.0f;
+}
+
+float SampleStats::get_peak() const { return std::max(std::fabs(this->min_), std::fabs(this->max_)); }
+
+void PowerStats::reset() {
+  this->voltage_.reset();
+  this->current_.reset();
+  this->voltage_offset_ = 0.0f;
+  this->current_offset_ = 0.0f;
+  this->product_sum_ = 0.0;
+}
+
+void PowerStats::add(const float *voltage, const float *current, size_t count) {
+  if (count == 0)
+    return;
+  if (this->voltage_.get_count() == 0) {
+    this->voltage_offset_ = voltage[0];
+    this->current_offset_ = current[0];
+  }
+  this->voltage_.add(voltage, count);
+  this->current_.add(current, count);
+
+  // same scheme as SampleStats::add(): four float sums per block, relative to the first samples
+  const float voltage_offset = this->voltage_offset_;
+  const float current_offset = this->current_offset_;
+  float product_sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    for (size_t j = 0; j < 4; j++)
+      product_sum[j] += (voltage[i + j] - voltage_offset) * (current[i + j] - current_offset);
+  }
+  for (; i < count; i++)
+    product_sum[0] += (voltage[i] - voltage_offset) * (current[i] - current_offset);
+  this->product_sum_ += (product_sum[0] + product_sum[1]) + (product_sum[2] + product_sum[3]);
+}
+
+float PowerStats::get_real_power() const {
+  const uint32_t count = this->voltage_.get_count();
+  if (count == 0)
+    return NAN;
+  // covariance of the two channels; the offsets cancel out
+  const double voltage_delta = this->voltage_.get_mean() - this->voltage_offset_;
+  const double current_delta = this->current_.get_mean() - this->current_offset_;
+  return this->product_sum_ / count - voltage_delta * current_delta;
+}
+
+float PowerStats::get_apparent_power() const { return this->voltage_.get_ac_rms() * this->current_.get_ac_rms(); }
+
+float PowerStats::get_power_factor() const {
+  const float apparent = this->get_apparent_power();
+  if (!(apparent > 0.0f))
+    return NAN;
+  return std::max(-1.0f, std::min(1.0f, this->get_real_power() / apparent));
+}
+
+}  // namespace voltage_sampler
+}  // namespace esphome
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace voltage_sampler {
+
+/** Mean, RMS and extremes of a stream of samples, added a block at a time.
+ *
+ * Each block is summed in float and then added to double totals, which keeps the totals precise over long sampling
+ * phases without doing double math per sample. Samples are summed relative to the first one, so a large DC offset
+ * doesn't eat into the precision of the AC part.
+ */
+class SampleStats {
+ public:
+  void reset();
+  void add(const float *samples, size_t count);
+  void add(float sample) { this->add(&sample, 1); }
+
+  uint32_t get_count() const { return this->count_; }
+  float get_mean() const;
+  /// RMS of the whole signal.
+  float get_rms() const;
+  /// RMS of the signal with its mean removed, i.e. its standard deviation.
+  float get_ac_rms() const;
+  float get_min() const { return this->min_; }
+  float get_max() const { return this->max_; }
+  /// Largest absolute value.
+  float get_peak() const;
+
+ protected:
+  uint32_t count_{0};
+  float offset_{0.0f};
+  double sum_{0.0};
+  double squared_sum_{0.0};
+  float min_{0.0f};
+  float max_{0.0f};
+};
+
+/** Statistics of simultaneously sampled voltage and current, added a block at a time.
+ *
+ * Besides the statistics of each channel, this sums the product of the two, from which the real power and power
+ * factor follow. Like the RMS values, the power is that of the AC part: the mean of each channel, e.g. the bias of
+ * a CT clamp input, is removed.
+ */
+class PowerStats {
+ public:
+  void reset();
+  void add(const float *voltage, const float *current, size_t count);
+
+  const SampleStats &get_voltage() const { return this->voltage_; }
+  const SampleStats &get_current() const { return this->current_; }
+  /// Mean of the instantaneous power.
+  float get_real_power() const;
+  /// Product of the voltage and current RMS.
+  float get_apparent_power() const;
+  /// Real over apparent power, NAN if there is no apparent power.
+  float get_power_factor() const;
+
+ protected:
+  SampleStats voltage_;
+  SampleStats current_;
+  float voltage_offset_{0.0f};
+  float current_offset_{0.0f};
+  double product_sum_{0.0};
+};
+
+}  // namespace voltage_sampler
+}  // namespace esphome
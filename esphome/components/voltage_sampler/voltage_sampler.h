@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "esphome/core/component.h"
 
 namespace esphome {
@@ -10,6 +13,17 @@ class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** Start taking samples at a fixed rate in the background, to be collected with read_samples().
+   *
+   * @param sample_rate Samples per second.
+   * @return Whether sampling started; if not, the sampler can't do this and sample() needs to be polled instead.
+   */
+  virtual bool start_continuous(uint32_t sample_rate) { return false; }
+  /// Stop taking samples in the background, dropping the ones that haven't been read.
+  virtual void stop_continuous() {}
+  /// Read up to count of the samples taken since start_continuous(), in V. Returns the number read.
+  virtual size_t read_samples(float *samples, size_t count) { return 0; }
 };
 
 }  // namespace voltage_sampler
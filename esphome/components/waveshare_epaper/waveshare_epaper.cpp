@@ -230,6 +230,30 @@ void WaveshareEPaperBase::start_data_() {
   this->enable();
 }
 void WaveshareEPaperBase::end_data_() { this->disable(); }
+void WaveshareEPaperBase::write_buffer_expanded_4bpp_() {
+  // double buffered: one buffer is expanded while the other one is being sent
+  uint8_t transfer_buffers[2][64];
+  uint8_t *transfer_buffer = transfer_buffers[0];
+  size_t idx = 0;
+  this->start_data_();
+  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
+    uint8_t pixels = this->buffer_[i];
+    for (uint8_t j = 0; j < 8; j += 2) {
+      transfer_buffer[idx++] = ((pixels & 0x80) ? 0x30 : 0x00) | ((pixels & 0x40) ? 0x03 : 0x00);
+      pixels <<= 2;
+    }
+    if (idx == sizeof(transfer_buffers[0])) {
+      this->write_array_async(transfer_buffer, idx);
+      transfer_buffer = transfer_buffer == transfer_buffers[0] ? transfer_buffers[1] : transfer_buffers[0];
+      this->wait_write_complete(1);
+      idx = 0;
+      App.feed_wdt();
+    }
+  }
+  if (idx != 0)
+    this->write_array(transfer_buffer, idx);
+  this->end_data_();
+}
 void WaveshareEPaperBase::on_safe_shutdown() { this->deep_sleep(); }
 
 // ========================================================
@@ -1965,32 +1989,7 @@ void HOT WaveshareEPaper5P8In::display() {
   // COMMAND DATA START TRANSMISSION 1
   this->command(0x10);
 
-  this->start_data_();
-  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
-    uint8_t temp1 = this->buffer_[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      uint8_t temp2;
-      if (temp1 & 0x80) {
-        temp2 = 0x03;
-      } else {
-        temp2 = 0x00;
-      }
-
-      temp2 <<= 4;
-      temp1 <<= 1;
-      j++;
-      if (temp1 & 0x80) {
-        temp2 |= 0x03;
-      } else {
-        temp2 |= 0x00;
-      }
-      temp1 <<= 1;
-      this->write_byte(temp2);
-    }
-
-    App.feed_wdt();
-  }
-  this->end_data_();
+  this->write_buffer_expanded_4bpp_();
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
@@ -2360,30 +2359,7 @@ void WaveshareEPaper7P5In::initialize() {
 void HOT WaveshareEPaper7P5In::display() {
   // COMMAND DATA START TRANSMISSION 1
   this->command(0x10);
-  this->start_data_();
-  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
-    uint8_t temp1 = this->buffer_[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      uint8_t temp2;
-      if (temp1 & 0x80) {
-        temp2 = 0x03;
-      } else {
-        temp2 = 0x00;
-      }
-      temp2 <<= 4;
-      temp1 <<= 1;
-      j++;
-      if (temp1 & 0x80) {
-        temp2 |= 0x03;
-      } else {
-        temp2 |= 0x00;
-      }
-      temp1 <<= 1;
-      this->write_byte(temp2);
-    }
-    App.feed_wdt();
-  }
-  this->end_data_();
+  this->write_buffer_expanded_4bpp_();
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
 }
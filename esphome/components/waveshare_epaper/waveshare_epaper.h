@@ -57,6 +57,8 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   void end_command_();
   void start_data_();
   void end_data_();
+  /// Send the 1 bit per pixel buffer as 4 bits per pixel (0x0 or 0x3), as expected by the older 4 gray controllers.
+  void write_buffer_expanded_4bpp_();
 
   GPIOPin *reset_pin_{nullptr};
   GPIOPin *dc_pin_;
@@ -147,9 +147,7 @@ std::string AsyncWebServerRequest::url() const {
 
 std::string AsyncWebServerRequest::host() const { return this->get_header("Host").value(); }
 
-void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
-  httpd_resp_send(*this, response->get_content_data(), response->get_content_size());
-}
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response) { response->send_body(*this); }
 
 void AsyncWebServerRequest::send(int code, const char *content_type, const char *content) {
   this->init_response_(nullptr, code, content_type);
@@ -250,6 +248,22 @@ void AsyncWebServerResponse::addHeader(const char *name, const char *value) {
   httpd_resp_set_hdr(*this->req_, name, value);
 }
 
+esp_err_t AsyncWebServerResponseChunked::send_body(httpd_req_t *req) {
+  // Small enough for the httpd task stack, the filler decides how much of it to use
+  uint8_t buffer[512];
+  size_t index = 0;
+  while (true) {
+    size_t len = this->filler_(buffer, sizeof(buffer), index);
+    if (len == 0)
+      break;
+    esp_err_t err = httpd_resp_send_chunk(req, reinterpret_cast<const char *>(buffer), len);
+    if (err != ESP_OK)
+      return err;
+    index += len;
+  }
+  return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
 void AsyncResponseStream::print(float value) { this->print(to_string(value)); }
 
 void AsyncResponseStream::printf(const char *fmt, ...) {
@@ -29,6 +29,9 @@ class AsyncWebParameter {
 
 class AsyncWebServerRequest;
 
+/// Fills buffer with up to max_len bytes of the response body starting at index, returns 0 when done.
+using AwsResponseFiller = std::function<size_t(uint8_t *buffer, size_t max_len, size_t index)>;
+
 class AsyncWebServerResponse {
  public:
   AsyncWebServerResponse(const AsyncWebServerRequest *req) : req_(req) {}
@@ -40,6 +43,11 @@ class AsyncWebServerResponse {
   virtual const char *get_content_data() const = 0;
   virtual size_t get_content_size() const = 0;
 
+  /// Send the response body, by default all of get_content_data() at once.
+  virtual esp_err_t send_body(httpd_req_t *req) {
+    return httpd_resp_send(req, this->get_content_data(), this->get_content_size());
+  }
+
  protected:
   const AsyncWebServerRequest *req_;
 };
@@ -80,6 +88,20 @@ class AsyncResponseStream : public AsyncWebServerResponse {
   std::string content_;
 };
 
+/// Response whose body is produced piece by piece and sent with chunked transfer encoding.
+class AsyncWebServerResponseChunked : public AsyncWebServerResponse {
+ public:
+  AsyncWebServerResponseChunked(const AsyncWebServerRequest *req, AwsResponseFiller filler)
+      : AsyncWebServerResponse(req), filler_(std::move(filler)) {}
+
+  const char *get_content_data() const override { return nullptr; };
+  size_t get_content_size() const override { return 0; };
+  esp_err_t send_body(httpd_req_t *req) override;
+
+ protected:
+  AwsResponseFiller filler_;
+};
+
 class AsyncWebServerResponseProgmem : public AsyncWebServerResponse {
  public:
   AsyncWebServerResponseProgmem(const AsyncWebServerRequest *req, const uint8_t *data, const size_t size)
@@ -133,6 +155,12 @@ class AsyncWebServerRequest {
     return res;
   }
   // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebServerResponse *beginChunkedResponse(const char *content_type, AwsResponseFiller filler) {
+    auto *res = new AsyncWebServerResponseChunked(this, std::move(filler));  // NOLINT(cppcoreguidelines-owning-memory)
+    this->init_response_(res, 200, content_type);
+    return res;
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
   AsyncResponseStream *beginResponseStream(const char *content_type) {
     auto *res = new AsyncResponseStream(this);  // NOLINT(cppcoreguidelines-owning-memory)
     this->init_response_(res, 200, content_type);
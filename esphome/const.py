@@ -655,6 +655,7 @@ CONF_PMC_1_0 = "pmc_1_0"
 CONF_PMC_10_0 = "pmc_10_0"
 CONF_PMC_2_5 = "pmc_2_5"
 CONF_PMC_4_0 = "pmc_4_0"
+CONF_POLL_INTERVAL = "poll_interval"
 CONF_PORT = "port"
 CONF_POSITION = "position"
 CONF_POSITION_ACTION = "position_action"
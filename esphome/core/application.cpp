@@ -65,10 +65,12 @@ void Application::setup() {
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
+  const uint32_t loop_start = millis();
 
   this->scheduler.call();
   this->feed_wdt();
-  for (Component *component : this->looping_components_) {
+  for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;) {
+    Component *component = this->looping_components_[this->current_loop_index_];
     {
       WarnIfComponentBlockingGuard guard{component};
       component->call();
@@ -76,10 +78,18 @@ void Application::loop() {
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
     this->feed_wdt();
+    // If a loop was disabled during call(), this slot may now hold a component not yet called in this pass
+    if (this->looping_components_[this->current_loop_index_] == component)
+      this->current_loop_index_++;
   }
+  this->current_loop_index_ = 0;
+  // Components with a disabled loop still contribute their status bits
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++)
+    new_app_state |= this->looping_components_[i]->get_component_state();
   this->app_state_ = new_app_state;
 
   const uint32_t now = millis();
+  this->max_loop_time_ = std::max(this->max_loop_time_, now - loop_start);
 
   auto elapsed = now - this->last_loop_;
   if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
@@ -144,10 +154,54 @@ void Application::run_safe_shutdown_hooks() {
 }
 
 void Application::calculate_looping_components_() {
+  // Enabled components first, then the ones that disabled their loop during setup
   for (auto *obj : this->components_) {
-    if (obj->has_overridden_loop())
+    if (obj->has_overridden_loop() && obj->is_loop_enabled()) {
+      obj->loop_index_ = this->looping_components_.size();
       this->looping_components_.push_back(obj);
+    }
   }
+  this->looping_components_active_end_ = this->looping_components_.size();
+  for (auto *obj : this->components_) {
+    if (obj->has_overridden_loop() && !obj->is_loop_enabled()) {
+      obj->loop_index_ = this->looping_components_.size();
+      this->looping_components_.push_back(obj);
+    }
+  }
+}
+void Application::swap_looping_components_(uint16_t a, uint16_t b) {
+  if (a == b)
+    return;
+  std::swap(this->looping_components_[a], this->looping_components_[b]);
+  this->looping_components_[a]->loop_index_ = a;
+  this->looping_components_[b]->loop_index_ = b;
+}
+void Application::disable_component_loop_(Component *component) {
+  uint16_t index = component->loop_index_;
+  // Not part of the active set (yet): calculate_looping_components_() will pick up the flag
+  if (index >= this->looping_components_active_end_ || this->looping_components_[index] != component)
+    return;
+  uint16_t last = this->looping_components_active_end_ - 1;
+  if (index < this->current_loop_index_) {
+    // Already called in this pass: shift the running component one slot down and move the last
+    // pending one into its place, so loop() picks that up next without skipping anything.
+    uint16_t running = this->current_loop_index_;
+    this->swap_looping_components_(index, running - 1);
+    this->swap_looping_components_(running - 1, running);
+    this->swap_looping_components_(running, last);
+    this->current_loop_index_--;
+  } else {
+    this->swap_looping_components_(index, last);
+  }
+  this->looping_components_active_end_--;
+}
+void Application::enable_component_loop_(Component *component) {
+  uint16_t index = component->loop_index_;
+  if (index < this->looping_components_active_end_ || index >= this->looping_components_.size() ||
+      this->looping_components_[index] != component)
+    return;
+  this->swap_looping_components_(index, this->looping_components_active_end_);
+  this->looping_components_active_end_++;
 }
 
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -231,6 +231,10 @@ class Application {
 
   uint32_t get_loop_interval() const { return this->loop_interval_; }
 
+  /// Longest time the components took in a single loop() iteration, in milliseconds, since reset_max_loop_time().
+  uint32_t get_max_loop_time() const { return this->max_loop_time_; }
+  void reset_max_loop_time() { this->max_loop_time_ = 0; }
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
   void feed_wdt();
@@ -467,11 +471,17 @@ class Application {
   void register_component_(Component *comp);
 
   void calculate_looping_components_();
+  void enable_component_loop_(Component *component);
+  void disable_component_loop_(Component *component);
+  void swap_looping_components_(uint16_t a, uint16_t b);
 
   void feed_wdt_arch_();
 
   std::vector<Component *> components_{};
+  /// Components overriding loop(); the first looping_components_active_end_ entries have their loop enabled.
   std::vector<Component *> looping_components_{};
+  uint16_t looping_components_active_end_{0};
+  uint16_t current_loop_index_{0};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
@@ -545,6 +555,7 @@ class Application {
   bool name_add_mac_suffix_;
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
+  uint32_t max_loop_time_{0};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
 };
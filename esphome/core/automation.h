@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
@@ -29,14 +32,50 @@ template<typename T, typename... X> class TemplatableValue {
   template<typename F, enable_if_t<!is_invocable<F, X...>::value, int> = 0>
   TemplatableValue(F value) : type_(VALUE), value_(value) {}
 
-  template<typename F, enable_if_t<is_invocable<F, X...>::value, int> = 0>
-  TemplatableValue(F f) : type_(LAMBDA), f_(f) {}
+  // Captureless lambdas are called through a plain function pointer
+  template<typename F, enable_if_t<is_invocable<F, X...>::value && std::is_convertible<F, T (*)(X...)>::value, int> = 0>
+  TemplatableValue(F f) : type_(STATELESS_LAMBDA), stateless_f_(f) {}
+
+  // Only lambdas with captures pay for a std::function, constants don't carry one around
+  template<typename F,
+           enable_if_t<is_invocable<F, X...>::value && !std::is_convertible<F, T (*)(X...)>::value, int> = 0>
+  TemplatableValue(F f) : type_(LAMBDA), f_(make_unique<std::function<T(X...)>>(std::move(f))) {}
+
+  TemplatableValue(const TemplatableValue &other)
+      : type_(other.type_), value_(other.value_), stateless_f_(other.stateless_f_) {
+    if (other.f_ != nullptr)
+      this->f_ = make_unique<std::function<T(X...)>>(*other.f_);
+  }
+  // The source is left without a value, rather than as a lambda without a function
+  TemplatableValue(TemplatableValue &&other)
+      : type_(other.type_), value_(std::move(other.value_)), stateless_f_(other.stateless_f_), f_(std::move(other.f_)) {
+    other.type_ = NONE;
+  }
+  TemplatableValue &operator=(const TemplatableValue &other) {
+    if (this != &other)
+      *this = TemplatableValue(other);
+    return *this;
+  }
+  TemplatableValue &operator=(TemplatableValue &&other) {
+    if (this != &other) {
+      this->type_ = other.type_;
+      this->value_ = std::move(other.value_);
+      this->stateless_f_ = other.stateless_f_;
+      this->f_ = std::move(other.f_);
+      other.type_ = NONE;
+    }
+    return *this;
+  }
+  ~TemplatableValue() = default;
 
   bool has_value() { return this->type_ != NONE; }
 
   T value(X... x) {
+    if (this->type_ == STATELESS_LAMBDA) {
+      return this->stateless_f_(x...);
+    }
     if (this->type_ == LAMBDA) {
-      return this->f_(x...);
+      return (*this->f_)(x...);
     }
     // return value also when none
     return this->value_;
@@ -60,11 +99,13 @@ template<typename T, typename... X> class TemplatableValue {
   enum {
     NONE,
     VALUE,
+    STATELESS_LAMBDA,
     LAMBDA,
   } type_;
 
   T value_{};
-  std::function<T(X...)> f_{};
+  T (*stateless_f_)(X...){nullptr};
+  std::unique_ptr<std::function<T(X...)>> f_;
 };
 
 /** Base class for all automation conditions.
@@ -76,6 +117,13 @@ template<typename... Ts> class Condition {
   /// Check whether this condition passes. This condition check must be instant, and not cause any delays.
   virtual bool check(Ts... x) = 0;
 
+  /** Subscribe to changes of the inputs of this condition.
+   *
+   * Returns true if callback will be called whenever the result of check() may have changed, so callers
+   * don't have to poll. Conditions that can't tell (lambdas, ...) return false and must be polled.
+   */
+  virtual bool add_on_change_callback(std::function<void()> &&callback) { return false; }
+
   /// Call check with a tuple of values as parameter.
   bool check_tuple(const std::tuple<Ts...> &tuple) {
     return this->check_tuple_(tuple, typename gens<sizeof...(Ts)>::type());
@@ -9,6 +9,18 @@
 
 namespace esphome {
 
+/// Subscribe callback to every condition; true only if all of them report their changes.
+template<typename... Ts>
+bool add_on_change_callback_all(const std::vector<Condition<Ts...> *> &conditions,
+                                const std::function<void()> &callback) {
+  bool reactive = true;
+  for (auto *condition : conditions) {
+    if (!condition->add_on_change_callback(std::function<void()>(callback)))
+      reactive = false;
+  }
+  return reactive;
+}
+
 template<typename... Ts> class AndCondition : public Condition<Ts...> {
  public:
   explicit AndCondition(const std::vector<Condition<Ts...> *> &conditions) : conditions_(conditions) {}
@@ -21,6 +33,10 @@ template<typename... Ts> class AndCondition : public Condition<Ts...> {
     return true;
   }
 
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    return add_on_change_callback_all(this->conditions_, callback);
+  }
+
  protected:
   std::vector<Condition<Ts...> *> conditions_;
 };
@@ -37,6 +53,10 @@ template<typename... Ts> class OrCondition : public Condition<Ts...> {
     return false;
   }
 
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    return add_on_change_callback_all(this->conditions_, callback);
+  }
+
  protected:
   std::vector<Condition<Ts...> *> conditions_;
 };
@@ -45,6 +65,9 @@ template<typename... Ts> class NotCondition : public Condition<Ts...> {
  public:
   explicit NotCondition(Condition<Ts...> *condition) : condition_(condition) {}
   bool check(Ts... x) override { return !this->condition_->check(x...); }
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    return this->condition_->add_on_change_callback(std::move(callback));
+  }
 
  protected:
   Condition<Ts...> *condition_;
@@ -62,6 +85,10 @@ template<typename... Ts> class XorCondition : public Condition<Ts...> {
     return result == 1;
   }
 
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    return add_on_change_callback_all(this->conditions_, callback);
+  }
+
  protected:
   std::vector<Condition<Ts...> *> conditions_;
 };
@@ -155,9 +182,10 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   TEMPLATABLE_VALUE(uint32_t, delay)
 
   void play_complex(Ts... x) override {
-    auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
     this->num_running_++;
-    this->set_timeout(this->delay_.value(x...), f);
+    // A lambda capturing only this and small trivially copyable arguments fits into std::function's
+    // inline storage, unlike the std::bind object, so scheduling a delay doesn't allocate a callback.
+    this->set_timeout(this->delay_.value(x...), [this, x...]() { this->play_next_(x...); });
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
@@ -312,6 +340,14 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
 
   TEMPLATABLE_VALUE(uint32_t, timeout_value)
 
+  /// Re-check conditions that can't report their changes every poll_interval ms instead of every loop.
+  void set_poll_interval(uint32_t poll_interval) { this->poll_interval_ = poll_interval; }
+
+  void setup() override {
+    // Conditions built from entity states wake this action up when one of their inputs changes
+    this->reactive_ = this->condition_->add_on_change_callback([this]() { this->enable_loop(); });
+  }
+
   void play_complex(Ts... x) override {
     this->num_running_++;
     // Check if we can continue immediately.
@@ -324,22 +360,32 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
     this->var_ = std::make_tuple(x...);
 
     if (this->timeout_value_.has_value()) {
-      auto f = std::bind(&WaitUntilAction<Ts...>::play_next_, this, x...);
-      this->set_timeout("timeout", this->timeout_value_.value(x...), f);
+      this->set_timeout("timeout", this->timeout_value_.value(x...), [this, x...]() { this->play_next_(x...); });
     }
+    if (!this->reactive_ && this->poll_interval_ != 0)
+      this->set_interval("poll", this->poll_interval_, [this]() { this->enable_loop(); });
 
+    this->enable_loop();
     this->loop();
   }
 
   void loop() override {
-    if (this->num_running_ == 0)
+    if (this->num_running_ == 0) {
+      // Idle (finished or timed out) until the next play_complex()
+      this->cancel_polling_();
+      this->disable_loop();
       return;
+    }
 
     if (!this->condition_->check_tuple(this->var_)) {
+      // Sleep until an input changes or the next poll
+      if (this->reactive_ || this->poll_interval_ != 0)
+        this->disable_loop();
       return;
     }
 
     this->cancel_timeout("timeout");
+    this->cancel_polling_();
 
     this->play_next_tuple_(this->var_);
   }
@@ -349,11 +395,21 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
   void play(Ts... x) override { /* ignore - see play_complex */
   }
 
-  void stop() override { this->cancel_timeout("timeout"); }
+  void stop() override {
+    this->cancel_timeout("timeout");
+    this->cancel_polling_();
+  }
 
  protected:
+  void cancel_polling_() {
+    if (!this->reactive_ && this->poll_interval_ != 0)
+      this->cancel_interval("poll");
+  }
+
   Condition<Ts...> *condition_;
   std::tuple<Ts...> var_{};
+  uint32_t poll_interval_{0};
+  bool reactive_{false};
 };
 
 template<typename... Ts> class UpdateComponentAction : public Action<Ts...> {
@@ -121,6 +121,18 @@ void Component::mark_failed() {
   this->component_state_ |= COMPONENT_STATE_FAILED;
   this->status_set_error();
 }
+void Component::disable_loop() {
+  if (!this->loop_enabled_)
+    return;
+  this->loop_enabled_ = false;
+  App.disable_component_loop_(this);
+}
+void Component::enable_loop() {
+  if (this->loop_enabled_)
+    return;
+  this->loop_enabled_ = true;
+  App.enable_component_loop_(this);
+}
 void Component::defer(std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", 0, std::move(f));
 }
@@ -142,6 +142,19 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() for this component until enable_loop() is called.
+   *
+   * Meant for components that only have work to do after some event (a transition, a queued run, ...):
+   * they disable their loop while idle instead of returning early on every iteration. Safe to call
+   * from within loop() and before setup has finished. Must not be called from an interrupt.
+   */
+  void disable_loop();
+
+  /// Resume calling loop() after disable_loop(). Must not be called from an interrupt.
+  void enable_loop();
+
+  bool is_loop_enabled() const { return this->loop_enabled_; }
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -272,6 +285,8 @@ class Component {
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+  uint16_t loop_index_{0};  ///< Position in Application::looping_components_, maintained by Application.
+  bool loop_enabled_{true};
 };
 
 /** This class simplifies creating components that periodically check a state.
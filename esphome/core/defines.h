@@ -56,8 +56,10 @@
 #define USE_NETWORK
 #define USE_NEXTION_TFT_UPLOAD
 #define USE_NUMBER
+#define USE_ONLINE_IMAGE_JPEG_SUPPORT
 #define USE_ONLINE_IMAGE_PNG_SUPPORT
 #define USE_OTA
+#define USE_OTA_DELTA
 #define USE_OTA_PASSWORD
 #define USE_OTA_STATE_CALLBACK
 #define USE_OTA_VERSION 1
@@ -17,6 +17,7 @@
 // Modified by Otto Winter on 18.05.18
 
 #include <algorithm>
+#include <utility>
 
 namespace esphome {
 
@@ -46,6 +47,8 @@ template<typename T> class optional {  // NOLINT
 
   optional(T const &arg) : has_value_(true), value_(arg) {}  // NOLINT
 
+  optional(T &&arg) : has_value_(true), value_(std::move(arg)) {}  // NOLINT
+
   template<class U> optional(optional<U> const &other) : has_value_(other.has_value()), value_(other.value()) {}
 
   optional &operator=(nullopt_t /*unused*/) {
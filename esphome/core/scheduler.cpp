@@ -10,6 +10,7 @@ namespace esphome {
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+static const size_t MAX_RECYCLED_ITEMS = 8;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -31,7 +32,7 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->make_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::TIMEOUT;
@@ -62,7 +63,7 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->make_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::INTERVAL;
@@ -250,6 +251,7 @@ void HOT Scheduler::call() {
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -262,6 +264,8 @@ void HOT Scheduler::call() {
             item->last_execution_major++;
         }
         this->push_(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -294,6 +298,24 @@ void HOT Scheduler::cleanup_() {
     }
   }
 }
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::make_item_() {
+  {
+    LockGuard guard{this->lock_};
+    if (!this->recycled_items_.empty()) {
+      auto item = std::move(this->recycled_items_.back());
+      this->recycled_items_.pop_back();
+      return item;
+    }
+  }
+  return make_unique<SchedulerItem>();
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // Release whatever the callback captured now rather than when the item is reused
+  item->callback = nullptr;
+  LockGuard guard{this->lock_};
+  if (this->recycled_items_.size() < MAX_RECYCLED_ITEMS)
+    this->recycled_items_.push_back(std::move(item));
+}
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   this->items_.pop_back();
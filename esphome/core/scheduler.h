@@ -67,6 +67,8 @@ class Scheduler {
   void cleanup_();
   void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
+  std::unique_ptr<SchedulerItem> make_item_();
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
   bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
@@ -76,6 +78,8 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  /// Finished timeouts kept for reuse, so frequently scheduled delays don't allocate a new item each time.
+  std::vector<std::unique_ptr<SchedulerItem>> recycled_items_;
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
@@ -0,0 +1,121 @@
+"""Create firmware deltas that devices with ``delta: true`` apply against their running image.
+
+See ``esphome/components/ota/ota_backend_delta.h`` for the format.
+"""
+
+import hashlib
+import logging
+from pathlib import Path
+import struct
+
+_LOGGER = logging.getLogger(__name__)
+
+MAGIC = b"ESPD"
+VERSION = 1
+OP_COPY = 0x01
+OP_INSERT = 0x02
+
+# Matches shorter than this cost more to encode as a copy than as literal data
+BLOCK_SIZE = 32
+
+
+def _header(old: bytes, new: bytes) -> bytes:
+    return (
+        MAGIC
+        + bytes([VERSION, 0, 0, 0])
+        + struct.pack("<I", len(old))
+        + hashlib.md5(old).digest()
+        + struct.pack("<I", len(new))
+        + hashlib.md5(new).digest()
+    )
+
+
+def _match_length(old: bytes, old_pos: int, new: bytes, new_pos: int) -> int:
+    length = 0
+    step = 256
+    while step > 0:
+        while (
+            old_pos + length + step <= len(old)
+            and new_pos + length + step <= len(new)
+            and old[old_pos + length : old_pos + length + step]
+            == new[new_pos + length : new_pos + length + step]
+        ):
+            length += step
+        step //= 2
+    return length
+
+
+def generate_patch(old: bytes, new: bytes) -> bytes:
+    """Create a delta that turns old into new."""
+    index = {}
+    for pos in range(0, len(old) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        index.setdefault(old[pos : pos + BLOCK_SIZE], pos)
+
+    ops = []
+    literal_start = 0
+    pos = 0
+    while pos + BLOCK_SIZE <= len(new):
+        old_pos = index.get(new[pos : pos + BLOCK_SIZE])
+        if old_pos is None:
+            pos += 1
+            continue
+        # Extend the match backwards into the pending literal data
+        while old_pos > 0 and pos > literal_start and old[old_pos - 1] == new[pos - 1]:
+            old_pos -= 1
+            pos -= 1
+        length = _match_length(old, old_pos, new, pos)
+        if pos > literal_start:
+            ops.append(struct.pack("<BI", OP_INSERT, pos - literal_start))
+            ops.append(new[literal_start:pos])
+        ops.append(struct.pack("<BII", OP_COPY, old_pos, length))
+        pos += length
+        literal_start = pos
+    if literal_start < len(new):
+        ops.append(struct.pack("<BI", OP_INSERT, len(new) - literal_start))
+        ops.append(new[literal_start:])
+    return _header(old, new) + b"".join(ops)
+
+
+def apply_patch(old: bytes, patch: bytes) -> bytes:
+    """Apply a delta, the same way devices do."""
+    if patch[:4] != MAGIC or patch[4] != VERSION:
+        raise ValueError("Not a firmware delta")
+    (old_size,) = struct.unpack_from("<I", patch, 8)
+    old = old[:old_size]
+    if len(old) != old_size or hashlib.md5(old).digest() != patch[12:28]:
+        raise ValueError("Delta was not made against this image")
+    (new_size,) = struct.unpack_from("<I", patch, 28)
+    result = bytearray()
+    pos = 48
+    while len(result) < new_size:
+        op = patch[pos]
+        if op == OP_COPY:
+            offset, length = struct.unpack_from("<II", patch, pos + 1)
+            result += old[offset : offset + length]
+            pos += 9
+        elif op == OP_INSERT:
+            (length,) = struct.unpack_from("<I", patch, pos + 1)
+            result += patch[pos + 5 : pos + 5 + length]
+            pos += 5 + length
+        else:
+            raise ValueError(f"Invalid delta operation 0x{op:02X}")
+    if pos != len(patch) or hashlib.md5(result).digest() != patch[32:48]:
+        raise ValueError("Delta is corrupt")
+    return bytes(result)
+
+
+def write_patch_file(old_path, new_path) -> Path:
+    """Create a delta for new_path next to it and return its path."""
+    old = Path(old_path).read_bytes()
+    new_path = Path(new_path)
+    new = new_path.read_bytes()
+    patch = generate_patch(old, new)
+    patch_path = new_path.with_suffix(".delta.bin")
+    patch_path.write_bytes(patch)
+    _LOGGER.info(
+        "Created delta of %d bytes for %d byte image (%.1f%%)",
+        len(patch),
+        len(new),
+        100.0 * len(patch) / max(len(new), 1),
+    )
+    return patch_path
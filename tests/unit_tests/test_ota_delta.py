@@ -0,0 +1,47 @@
+import random
+
+import pytest
+
+from esphome import ota_delta
+
+
+def _firmware(seed, size):
+    rand = random.Random(seed)
+    return bytes(rand.getrandbits(8) for _ in range(size))
+
+
+@pytest.mark.parametrize(
+    "edit",
+    (
+        lambda old: old,
+        lambda old: old[:1000] + b"inserted" + old[1000:],
+        lambda old: old[:5000] + old[5100:],
+        lambda old: old[20000:] + old[:20000],
+        lambda old: old + _firmware(2, 3000),
+        lambda old: b"",
+    ),
+)
+def test_patch_roundtrip(edit):
+    old = _firmware(1, 32768)
+    new = edit(old)
+
+    patch = ota_delta.generate_patch(old, new)
+
+    assert ota_delta.apply_patch(old, patch) == new
+
+
+def test_patch_is_small_for_small_changes():
+    old = _firmware(1, 32768)
+    new = old[:1000] + b"inserted" + old[1000:]
+
+    patch = ota_delta.generate_patch(old, new)
+
+    assert len(patch) < 100
+
+
+def test_patch_rejects_other_base():
+    old = _firmware(1, 4096)
+    patch = ota_delta.generate_patch(old, old)
+
+    with pytest.raises(ValueError):
+        ota_delta.apply_patch(_firmware(3, 4096), patch)